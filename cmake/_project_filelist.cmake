@@ -11,37 +11,71 @@ source_group("Shims" FILES ${SHIMS_HEADERS})
 # ==================================================================================== #
 
 set(FRONTEND_HEADERS
+	"${PROJECT_INCLUDE_DIR}/frontend/ConsoleTool.hpp"
 	"${PROJECT_INCLUDE_DIR}/frontend/FrontendHost.hpp"
 	"${PROJECT_INCLUDE_DIR}/frontend/FrontendInterface.hpp"
+	"${PROJECT_INCLUDE_DIR}/frontend/HeadlessHost.hpp"
 )
 set(FRONTEND_SOURCES
 	"${PROJECT_INCLUDE_DIR}/frontend/CubeChip.cpp" # main
 	"${PROJECT_INCLUDE_DIR}/frontend/FrontendHost.cpp"
-	"${PROJECT_INCLUDE_DIR}/frontend/FrontendInterface.cpp"
+	"${PROJECT_INCLUDE_DIR}/frontend/HeadlessHost.cpp"
 )
 source_group("Frontend" FILES ${FRONTEND_HEADERS} ${FRONTEND_SOURCES})
 
+# linked into every executable, the video service draws through the interface
+# and the console tools start up through ConsoleTool
+set(SHARED_FRONTEND_SOURCES
+	"${PROJECT_INCLUDE_DIR}/frontend/ConsoleTool.cpp"
+	"${PROJECT_INCLUDE_DIR}/frontend/FrontendInterface.cpp"
+)
+source_group("Frontend" FILES ${SHARED_FRONTEND_SOURCES})
+
+set(BATCH_SOURCES
+	"${PROJECT_INCLUDE_DIR}/frontend/CubeChipBatch.cpp" # main
+)
+source_group("Frontend" FILES ${BATCH_SOURCES})
+
+set(BENCH_SOURCES
+	"${PROJECT_INCLUDE_DIR}/frontend/CubeChipBench.cpp" # main
+)
+source_group("Frontend" FILES ${BENCH_SOURCES})
+
 # ==================================================================================== #
 
 set(COMPONENTS_HEADERS
 	"${PROJECT_INCLUDE_DIR}/components/Aligned.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/AudioCapture.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/AudioDevice.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/AudioFilters.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/BasicInput.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/CycleController.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/FrameLimiter.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/Map2D.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/PackedPlane.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/RangeIterator.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/SampleClock.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/SimpleRingBuffer.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/ThreadPolicy.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/TimeStretch.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/TripleBuffer.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/VideoSink.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/Voice.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/VoicePool.hpp"
 	"${PROJECT_INCLUDE_DIR}/components/Well512.hpp"
+	"${PROJECT_INCLUDE_DIR}/components/WorkStealingPool.hpp"
 )
 set(COMPONENTS_SOURCES
+	"${PROJECT_INCLUDE_DIR}/components/AudioCapture.cpp"
 	"${PROJECT_INCLUDE_DIR}/components/AudioDevice.cpp"
 	"${PROJECT_INCLUDE_DIR}/components/AudioFilters.cpp"
 	"${PROJECT_INCLUDE_DIR}/components/BasicInput.cpp"
+	"${PROJECT_INCLUDE_DIR}/components/CycleController.cpp"
 	"${PROJECT_INCLUDE_DIR}/components/FrameLimiter.cpp"
+	"${PROJECT_INCLUDE_DIR}/components/ThreadPolicy.cpp"
+	"${PROJECT_INCLUDE_DIR}/components/TimeStretch.cpp"
 	"${PROJECT_INCLUDE_DIR}/components/Well512.cpp"
+	"${PROJECT_INCLUDE_DIR}/components/WorkStealingPool.cpp"
 )
 source_group("Components" FILES ${COMPONENTS_HEADERS} ${COMPONENTS_SOURCES})
 
@@ -0,0 +1,103 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <algorithm>
+
+#include "AudioCapture.hpp"
+
+/*==================================================================*/
+
+template <typename T>
+static void writeLE(std::ofstream& file, T value) {
+	std::array<char, sizeof(T)> bytes{};
+	for (auto i{ 0u }; i < sizeof(T); ++i)
+		{ bytes[i] = char(value >> (i * 8) & 0xFF); }
+	file.write(bytes.data(), bytes.size());
+}
+
+/*==================================================================*/
+
+AudioCapture::AudioCapture(const std::filesystem::path& filePath, unsigned freq, unsigned channels)
+	: mFile{ filePath, std::ios::binary | std::ios::out | std::ios::trunc }
+	// about two seconds of slack before anything is dropped
+	, mSamples{ std::bit_ceil(std::max(freq * channels * 2u, 1024u)) }
+	, mFreq{ freq }, mChannels{ std::max(channels, 1u) }
+	, mIsWave{ filePath.extension() == ".wav" }
+{
+	if (!mFile) { return; }
+	if (mIsWave) { writeHeader(); }
+	mWriter = Thread([this](StopToken token) { writerEntry(token); });
+}
+
+AudioCapture::~AudioCapture() noexcept {
+	if (mWriter.joinable()) {
+		mWriter.request_stop();
+		mWriter.join();
+	}
+	if (mFile && mIsWave) {
+		mFile.seekp(0);
+		writeHeader();
+	}
+}
+
+void AudioCapture::write(const float* samples, std::size_t count) noexcept {
+	if (!isOpen()) { return; }
+	for (auto i{ 0u }; i < count; ++i) {
+		if (!mSamples.try_push(samples[i])) {
+			mDropped.fetch_add(count - i, std::memory_order_relaxed);
+			return;
+		}
+	}
+}
+
+/*==================================================================*/
+
+void AudioCapture::writerEntry(StopToken token) {
+	using namespace std::chrono_literals;
+	while (!token.stop_requested()) {
+		drain();
+		std::this_thread::sleep_for(5ms);
+	}
+	drain();
+	mFile.flush();
+}
+
+void AudioCapture::drain() {
+	std::array<float, 4096> block;
+	for (;;) {
+		auto count{ 0u };
+		while (count < block.size() && mSamples.try_pop(block[count])) { ++count; }
+		if (!count) { return; }
+
+		if constexpr (std::endian::native == std::endian::little) {
+			mFile.write(reinterpret_cast<const char*>(block.data()), count * sizeof(float));
+		} else {
+			for (auto i{ 0u }; i < count; ++i)
+				{ writeLE(mFile, std::bit_cast<std::uint32_t>(block[i])); }
+		}
+		mWritten += count * sizeof(float);
+	}
+}
+
+void AudioCapture::writeHeader() {
+	static constexpr std::uint16_t formatFloat{ 3 };
+	const auto dataSize{ std::uint32_t(std::min<std::uint64_t>(mWritten, 0xFFFFFFFFu - 36u)) };
+	const auto blockAlign{ std::uint16_t(mChannels * sizeof(float)) };
+
+	mFile.write("RIFF", 4); writeLE(mFile, std::uint32_t(36u + dataSize));
+	mFile.write("WAVE", 4);
+	mFile.write("fmt ", 4); writeLE(mFile, std::uint32_t(16));
+	writeLE(mFile, formatFloat);
+	writeLE(mFile, std::uint16_t(mChannels));
+	writeLE(mFile, std::uint32_t(mFreq));
+	writeLE(mFile, std::uint32_t(mFreq * blockAlign));
+	writeLE(mFile, blockAlign);
+	writeLE(mFile, std::uint16_t(32));
+	mFile.write("data", 4); writeLE(mFile, dataSize);
+}
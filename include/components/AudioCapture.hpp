@@ -0,0 +1,63 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <filesystem>
+
+#include <atomic_queue/atomic_queue.h>
+
+#include "Thread.hpp"
+
+/*==================================================================*/
+
+/**
+ * @brief Tees f32 audio blocks into a file from a background writer thread.
+ *
+ * @details
+ * Producers only ever push into a bounded lock-free ring, samples that do
+ * not fit are counted as dropped rather than waited on, so disk I/O never
+ * stalls the emulation thread. Paths ending in ".wav" get a 32-bit float
+ * WAVE header (sizes patched on close), anything else is written raw,
+ * which also suits named pipes.
+ */
+class AudioCapture {
+	using Ring = atomic_queue::AtomicQueueB2<float,
+		std::allocator<float>, true, false, true>;
+
+	std::ofstream mFile;
+	Ring mSamples;
+
+	unsigned mFreq{}, mChannels{};
+	bool mIsWave{};
+
+	std::uint64_t mWritten{};  // bytes of sample data, writer thread only
+	std::atomic<std::uint64_t> mDropped{};
+
+	Thread mWriter; // declared last, joined before the ring and file go away
+
+	void writerEntry(StopToken token);
+	void writeHeader();
+	void drain();
+
+public:
+	AudioCapture(const std::filesystem::path& filePath, unsigned freq, unsigned channels);
+	~AudioCapture() noexcept;
+
+	AudioCapture(const AudioCapture&) = delete;
+	AudioCapture& operator=(const AudioCapture&) = delete;
+
+	bool isOpen() const noexcept { return mFile.is_open(); }
+
+	// Samples discarded so far because the writer fell behind.
+	auto getDropped() const noexcept { return mDropped.load(std::memory_order_relaxed); }
+
+	// Queues samples for writing, never blocks.
+	void write(const float* samples, std::size_t count) noexcept;
+};
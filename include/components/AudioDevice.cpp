@@ -5,12 +5,18 @@
 */
 
 #include <vector>
+#include <mutex>
+#include <atomic>
+#include <bit>
 #include <algorithm>
 #include <cassert>
 
-#include "AssignCast.hpp"
+#include <atomic_queue/atomic_queue.h>
+
 #include "GlobalAudioBase.hpp"
 #include "AudioDevice.hpp"
+#include "TimeStretch.hpp"
+#include "AudioCapture.hpp"
 #include "LifetimeWrapperSDL.hpp"
 #include "BasicLogger.hpp"
 
@@ -18,38 +24,150 @@
 
 /*==================================================================*/
 
-static float calculateGain(float streamGain) noexcept {
-	return streamGain * (GlobalAudioBase::isMuted()
-		? 0.0f : GlobalAudioBase::getGlobalGain());
+struct AudioDevice::PullRing {
+	using Ring = atomic_queue::AtomicQueueB2<float,
+		std::allocator<float>, true, false, true>;
+
+	Ring samples;
+	std::atomic<float> gain{ 1.0f };
+	std::vector<float> scratch;
+
+	PullRing(unsigned capacity)
+		: samples{ capacity }, scratch(capacity)
+	{}
+
+	static void SDLCALL drain(void* userdata, SDL_AudioStream* stream, int additional, int) {
+		auto* self{ static_cast<PullRing*>(userdata) };
+		const auto wanted{ std::min(std::size_t(additional) / sizeof(float), self->scratch.size()) };
+		const auto gain{ GlobalAudioBase::getEffectiveGain(self->gain.load(std::memory_order_relaxed)) };
+
+		auto count{ 0u };
+		for (; count < wanted && self->samples.try_pop(self->scratch[count]); ++count)
+			{ self->scratch[count] *= gain; }
+
+		if (count) { SDL_PutAudioStreamData(stream, self->scratch.data(), signed(count * sizeof(float))); }
+	}
+};
+
+/*==================================================================*/
+
+struct AudioDevice::MixerLink {
+	SDL_AudioStream* input;
+	bool attached{};
+
+	MixerLink(SDL_AudioStream* input) noexcept
+		: input{ input }
+	{}
+	~MixerLink() noexcept { detach(); }
+
+	void attach() {
+		if (!attached) { GlobalAudioBase::attachMixerInput(input); }
+		attached = true;
+	}
+	void detach() noexcept {
+		if (attached) { GlobalAudioBase::detachMixerInput(input); }
+		attached = false;
+	}
+};
+
+/*==================================================================*/
+
+static std::mutex sCaptureSlotLock;
+static std::vector<bool> sCaptureSlots;
+
+static unsigned claimCaptureSlot() {
+	std::lock_guard lock{ sCaptureSlotLock };
+	const auto free{ std::find(sCaptureSlots.begin(), sCaptureSlots.end(), false) };
+	const auto slot{ unsigned(free - sCaptureSlots.begin()) };
+
+	if (free == sCaptureSlots.end()) { sCaptureSlots.push_back(true); }
+	else { *free = true; }
+	return slot + 1;
+}
+
+static void releaseCaptureSlot(unsigned slot) noexcept {
+	if (!slot) { return; }
+	std::lock_guard lock{ sCaptureSlotLock };
+	sCaptureSlots[slot - 1] = false;
 }
 
 /*==================================================================*/
 	#pragma region AudioDevice Class
 
+AudioDevice::~AudioDevice() noexcept {
+	// the capture files are closed before another device may reuse their names
+	audioStreams.clear();
+	releaseCaptureSlot(captureSlot);
+}
+
 bool AudioDevice::addAudioStream(
 	unsigned streamID, unsigned frequency,
 	unsigned channels, unsigned device
 ) {
 	SDL_AudioSpec spec{ SDL_AUDIO_F32, signed(channels), signed(frequency) };
 
+	if (GlobalAudioBase::getStatus() == GlobalAudioBase::STATUS::NO_AUDIO) {
+		// nothing to play to, but the output can still be captured
+		if (GlobalAudioBase::getCapturePath().empty()) { return false; }
+		return emplaceStream(streamID, Stream(nullptr, spec.format, spec.freq, spec.channels));
+	}
+
+	if (GlobalAudioBase::isMixerActive()) {
+		// an unbound stream only converts to the mixer's format, the mixer pulls from it
+		static constexpr SDL_AudioSpec mixerSpec{ SDL_AUDIO_F32, 1, GlobalAudioBase::cMixerFrequency };
+
+		auto* ptr{ SDL_CreateAudioStream(&spec, &mixerSpec) };
+		if (!ptr) {
+			blog.newEntry(BLOG::WARN, "Failed to create mixer input stream: {}", SDL_GetError());
+			return false;
+		}
+		return emplaceStream(streamID, Stream(ptr, spec.format, spec.freq,
+			spec.channels, nullptr, std::make_unique<MixerLink>(ptr)));
+	}
+
+	// about half a second of headroom, the callback drains it continuously
+	auto pull{ GlobalAudioBase::isPullModel()
+		? std::make_unique<PullRing>(std::bit_ceil(frequency * channels / 2))
+		: nullptr };
+
 	auto* ptr{ SDL_OpenAudioDeviceStream(
 		device ? device : SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK
-		, &spec, nullptr, nullptr) };
+		, &spec, pull ? PullRing::drain : nullptr, pull.get()) };
 
 	if (!ptr) {
 		blog.newEntry(BLOG::WARN, "Failed to open audio stream: {}", SDL_GetError());
 		return false;
 	}
 
-	if (auto slot{ at(streamID) }) {
-		*slot = Stream(ptr, spec.format, spec.freq, spec.channels);
-		return true;
-	} else {
-		auto result{ audioStreams.try_emplace(streamID,
-			ptr, spec.format, spec.freq, spec.channels) };
+	return emplaceStream(streamID, Stream(ptr,
+		spec.format, spec.freq, spec.channels, std::move(pull)));
+}
 
-		return result.second;
+bool AudioDevice::emplaceStream(unsigned streamID, Stream&& stream) {
+	auto* slot{ at(streamID) };
+	if (slot) { *slot = std::move(stream); }
+	else {
+		auto result{ audioStreams.try_emplace(streamID, std::move(stream)) };
+		if (!result.second) { return false; }
+		slot = &result.first->second;
 	}
+
+	// opened only after any previous stream in this slot has closed its file
+	if (const auto& capturePath{ GlobalAudioBase::getCapturePath() }; !capturePath.empty()) {
+		if (!captureSlot) { captureSlot = claimCaptureSlot(); }
+
+		std::filesystem::path filePath{ capturePath };
+		if (captureSlot > 1 || streamID) {
+			filePath.replace_filename(filePath.stem().string()
+				+ (captureSlot > 1 ? "_inst" + std::to_string(captureSlot - 1) : "")
+				+ (streamID ? "_" + std::to_string(streamID) : "")
+				+ filePath.extension().string());
+		}
+		if (!slot->startCapture(filePath)) {
+			blog.newEntry(BLOG::WARN, "Failed to open audio capture file: {}", filePath.string());
+		}
+	}
+	return true;
 }
 
 /*==================================================================*/
@@ -59,12 +177,12 @@ unsigned AudioDevice::getStreamCount() const noexcept
 
 void AudioDevice::pauseStreams() noexcept {
 	for (auto& stream : audioStreams)
-		{ SDL_PauseAudioStreamDevice(stream.second); }
+		{ stream.second.pause(); }
 }
 
 void AudioDevice::resumeStreams() noexcept {
 	for (auto& stream : audioStreams)
-		{ SDL_ResumeAudioStreamDevice(stream.second); }
+		{ stream.second.resume(); }
 }
 
 	#pragma endregion
@@ -72,27 +190,59 @@ void AudioDevice::resumeStreams() noexcept {
 
 AudioDevice::Stream::Stream(
 	SDL_AudioStream* ptr,
-	unsigned format, unsigned freq, unsigned channels
+	unsigned format, unsigned freq, unsigned channels,
+	std::unique_ptr<PullRing> pull,
+	std::unique_ptr<MixerLink> mixer
 ) noexcept
-	: ptr     { ptr      }
+	: pull    { std::move(pull) }
+	, ptr     { ptr      }
+	, mixer   { std::move(mixer) }
 	, format  { format   }
 	, freq    { freq     }
 	, channels{ channels }
 {}
 
+AudioDevice::Stream::~Stream() noexcept = default;
+AudioDevice::Stream::Stream(Stream&&) noexcept = default;
+auto AudioDevice::Stream::operator=(Stream&& other) noexcept -> Stream& {
+	// leave the mixer and close our device before its ring goes away
+	mixer = std::move(other.mixer);
+	ptr   = std::move(other.ptr);
+	pull  = std::move(other.pull);
+	format      = other.format;
+	freq        = other.freq;
+	channels    = other.channels;
+	clock       = other.clock;
+	mixBuffer   = std::move(other.mixBuffer);
+	stretch     = std::move(other.stretch);
+	capture     = std::move(other.capture);
+	queueAverage   = other.queueAverage;
+	rateCorrection = other.rateCorrection;
+	return *this;
+}
+
 auto AudioDevice::Stream::getSpec() const noexcept -> SDL_AudioSpec {
 	return { SDL_AudioFormat(format), signed(freq), signed(channels) };
 }
 
 bool AudioDevice::Stream::isPaused() const noexcept {
+	if (mixer) { return !mixer->attached; }
 	const auto deviceID{ SDL_GetAudioStreamDevice(ptr) };
 	return deviceID ? SDL_AudioDevicePaused(deviceID) : true;
 }
 
 bool AudioDevice::Stream::isPlayback() const noexcept {
+	if (mixer) { return true; }
 	return SDL_IsAudioDevicePlayback(SDL_GetAudioStreamDevice(ptr));
 }
 
+unsigned AudioDevice::Stream::getQueuedSamples() const noexcept {
+	if (!ptr && !pull) { return 0u; }
+	const auto queued{ pull ? pull->samples.was_size() * sizeof(float)
+		: unsigned(std::max(SDL_GetAudioStreamQueued(ptr), 0)) };
+	return unsigned(queued / sizeof(float) / std::max(channels, 1u));
+}
+
 float AudioDevice::Stream::getRawSampleRate(float framerate) const noexcept {
 	if (framerate < 1.0) { return 0.0; }
 	return freq / framerate * channels;
@@ -101,34 +251,105 @@ float AudioDevice::Stream::getRawSampleRate(float framerate) const noexcept {
 unsigned AudioDevice::Stream::getNextBufferSize(float framerate) noexcept {
 	if (framerate < 1.0f) { return 0u; }
 
-	static constexpr auto scale_factor{ 1ull << 24 };
-	::assign_cast_add(accumulator, freq / framerate * scale_factor);
-	const auto sample_amount{ accumulator >> 24 };
-	::assign_cast_and(accumulator, scale_factor - 1);
+	static constexpr auto max_correction{ 0.005f };
+
+	const auto oldCorrection{ rateCorrection };
+	if (const auto target{ GlobalAudioBase::getTargetLatency() * 0.001f * freq }; target > 0.0f && ptr) {
+		queueAverage += (getQueuedSamples() - queueAverage) * 0.05f;
+		rateCorrection = 1.0f + std::clamp((target - queueAverage) / target
+			* (max_correction * 2.0f), -max_correction, +max_correction);
+	} else {
+		rateCorrection = 1.0f;
+	}
+
+	// resampled by the SDL stream, stretching would add a grain of latency
+	if (ptr && rateCorrection != oldCorrection)
+		{ SDL_SetAudioStreamFrequencyRatio(ptr, 1.0f / rateCorrection); }
+
+	return clock.nextFrame(freq, framerate) * channels;
+}
 
-	return unsigned(sample_amount * channels);
+std::span<float> AudioDevice::Stream::borrowMixBuffer(unsigned size) {
+	mixBuffer.assign(size, 0.0f);
+	return { mixBuffer.data(), size };
 }
 
-void AudioDevice::Stream::pause() noexcept
-	{ SDL_PauseAudioStreamDevice(ptr); }
+void AudioDevice::Stream::pause() noexcept {
+	if (mixer) { mixer->detach(); }
+	else { SDL_PauseAudioStreamDevice(ptr); }
+}
 
-void AudioDevice::Stream::resume() noexcept
-	{ SDL_ResumeAudioStreamDevice(ptr); }
+void AudioDevice::Stream::resume() noexcept {
+	if (mixer) { mixer->attach(); }
+	else { SDL_ResumeAudioStreamDevice(ptr); }
+}
 
-float AudioDevice::Stream::getGain() const noexcept
-	{ return SDL_GetAudioStreamGain(ptr); }
+float AudioDevice::Stream::getGain() const noexcept {
+	return pull ? pull->gain.load(std::memory_order_relaxed)
+		: SDL_GetAudioStreamGain(ptr);
+}
 
-void AudioDevice::Stream::setGain(float new_gain) noexcept
-	{ SDL_SetAudioStreamGain(ptr, new_gain); }
+void AudioDevice::Stream::setGain(float new_gain) noexcept {
+	if (pull) { pull->gain.store(new_gain, std::memory_order_relaxed); }
+	else { SDL_SetAudioStreamGain(ptr, new_gain); }
+}
 
 void AudioDevice::Stream::addGain(float add_gain) noexcept
 	{ setGain(getGain() + add_gain); }
 
-void AudioDevice::Stream::pushRawAudio(void* sampleData,
+void AudioDevice::Stream::pushRawAudio(const void* sampleData,
+	std::size_t bufferSize, std::size_t sampleSize
+) const {
+	if (capture && sampleSize == sizeof(float))
+		{ capture->write(static_cast<const float*>(sampleData), bufferSize); }
+
+	pushToDevice(sampleData, bufferSize, sampleSize);
+}
+
+void AudioDevice::Stream::pushToDevice(const void* sampleData,
 	std::size_t bufferSize, std::size_t sampleSize
 ) const {
+	if (!ptr) { return; }
+
+	if (pull) {
+		// no driver calls here, gain is applied by the callback and a full
+		// ring (paused or stalled device) simply drops the overflow
+		assert(sampleSize == sizeof(float));
+		const auto* samples{ static_cast<const float*>(sampleData) };
+		for (auto i{ 0u }; i < bufferSize; ++i)
+			{ if (!pull->samples.try_push(samples[i])) { break; } }
+		return;
+	}
+
 	if (isPaused() || bufferSize == 0u) { return; }
 
-	SDL_SetAudioDeviceGain(SDL_GetAudioStreamDevice(ptr), calculateGain(getGain()));
+	if (!mixer) {
+		// the shared mixer applies the global gain once, to the sum
+		SDL_SetAudioDeviceGain(SDL_GetAudioStreamDevice(ptr),
+			GlobalAudioBase::getEffectiveGain(getGain()));
+	}
 	SDL_PutAudioStreamData(ptr, sampleData, signed(bufferSize * sampleSize));
 }
+
+void AudioDevice::Stream::pushStretchedAudio(std::span<const float> samples, float ratio) {
+	if (capture) { capture->write(samples.data(), samples.size()); }
+
+	if (channels != 1u || ratio == 1.0f) {
+		if (stretch) { stretch->reset(); }
+		pushToDevice(samples.data(), samples.size(), sizeof(float));
+		return;
+	}
+
+	if (!stretch) { stretch = std::make_unique<TimeStretch>(); }
+	const auto output{ stretch->process(samples, ratio) };
+	pushToDevice(output.data(), output.size(), sizeof(float));
+}
+
+bool AudioDevice::Stream::startCapture(const std::filesystem::path& filePath) {
+	capture = std::make_unique<AudioCapture>(filePath, freq, channels);
+	if (!capture->isOpen()) { capture.reset(); }
+	return !!capture;
+}
+
+void AudioDevice::Stream::stopCapture() noexcept
+	{ capture.reset(); }
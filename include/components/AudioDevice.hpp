@@ -6,33 +6,62 @@
 
 #pragma once
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
+#include <span>
+#include <filesystem>
 
 #include "Concepts.hpp"
+#include "SampleClock.hpp"
 #include "LifetimeWrapperSDL.hpp"
 
 
 /*==================================================================*/
 
 struct SDL_AudioSpec;
+class TimeStretch;
+class AudioCapture;
 
 /*==================================================================*/
 
 class AudioDevice {
 	using self = AudioDevice;
 
+	// Lock-free sample ring drained by the device callback, pull model only.
+	struct PullRing;
+
+	// Registration of a stream with the shared mixer, shared mixer only.
+	struct MixerLink;
+
 public:
 	class Stream {
+		std::unique_ptr<PullRing> pull; // outlives ptr, which closes the device first
 		SDL_Unique<SDL_AudioStream> ptr;
+		std::unique_ptr<MixerLink> mixer; // detaches from the mixer before ptr goes away
 		unsigned format{}; unsigned freq{};
 		unsigned channels{};
-		unsigned long long accumulator{};
+		SampleClock clock;
+		std::vector<float> mixBuffer;
+		std::unique_ptr<TimeStretch> stretch; // created on first stretched push
+		std::unique_ptr<AudioCapture> capture;
+
+		float queueAverage{};          // smoothed queue depth, in samples
+		float rateCorrection{ 1.0f };  // applied as the SDL stream's frequency ratio, not the sample count
+
+		void pushToDevice(const void* sampleData, std::size_t bufferSize, std::size_t sampleSize) const;
 
 	public:
 		Stream(
 			SDL_AudioStream* ptr,
-			unsigned format, unsigned freq, unsigned channels
+			unsigned format, unsigned freq, unsigned channels,
+			std::unique_ptr<PullRing> pull = {},
+			std::unique_ptr<MixerLink> mixer = {}
 		) noexcept;
+		~Stream() noexcept;
+
+		Stream(Stream&&) noexcept;
+		Stream& operator=(Stream&&) noexcept;
 
 		auto getSpec()     const noexcept -> SDL_AudioSpec;
 		auto getFormat()   const noexcept { return format; }
@@ -42,11 +71,52 @@ public:
 		bool isPaused()   const noexcept;
 		bool isPlayback() const noexcept;
 
+		// Whether samples are pulled from a ring by the device callback.
+		bool isPullModel() const noexcept { return !!pull; }
+
+		// Whether samples are summed by the shared mixer rather than a device of its own.
+		bool isMixed() const noexcept { return !!mixer; }
+
+		// Whether the stream only exists for capture, with no device behind it.
+		bool isDeviceless() const noexcept { return !ptr; }
+
+		/**
+		 * @brief Starts teeing every pushed f32 block into a file (".wav" for a WAVE
+		 *        file, anything else raw). Writing happens on a background thread.
+		 * @return Whether the file could be opened.
+		 */
+		bool startCapture(const std::filesystem::path& filePath);
+		void stopCapture() noexcept;
+		bool isCapturing() const noexcept { return !!capture; }
+
+		// Samples queued ahead of playback, per channel.
+		unsigned getQueuedSamples() const noexcept;
+
 		float getRawSampleRate(float framerate) const noexcept;
 
+		/**
+		 * @brief Returns the sample count to generate for the next frame, taken from
+		 *        the stream's integer sample clock so it only depends on how many
+		 *        frames were emulated at the given framerate. Also updates the rate
+		 *        correction, resampling the stream to steer the queued samples
+		 *        towards the target latency, by at most +/-0.5%.
+		 */
 		[[nodiscard]]
 		unsigned getNextBufferSize(float framerate) noexcept;
 
+		// Current dynamic rate control factor, 1.0 when idle or disabled.
+		float getRateCorrection() const noexcept { return rateCorrection; }
+
+		// Samples per channel generated so far on the stream's sample clock.
+		auto getTimelinePosition() const noexcept { return clock.getPosition(); }
+
+		/**
+		 * @brief Borrows the stream's pooled mixing buffer, zeroed and sized to the
+		 *        given sample count. Storage is reused between calls, only growing.
+		 */
+		[[nodiscard]]
+		std::span<float> borrowMixBuffer(unsigned size);
+
 		void pause() noexcept;
 		void resume() noexcept;
 
@@ -57,7 +127,17 @@ public:
 		operator SDL_AudioStream*() const noexcept
 			{ return ptr.get(); }
 
-		void pushRawAudio(void* sampleData, std::size_t bufferSize, std::size_t sampleSize) const;
+		void pushRawAudio(const void* sampleData, std::size_t bufferSize, std::size_t sampleSize) const;
+
+		/**
+		 * @brief Pushes mono samples generated at emulated speed, time-stretched by
+		 *        the given tempo ratio so pitch holds under a framerate multiplier.
+		 *        Captures see the samples before any stretching. A ratio of 1 and
+		 *        multi-channel streams are pushed as they are.
+		 * @param[in] samples :: audio samples at emulated speed.
+		 * @param[in] ratio   :: tempo ratio, the current framerate multiplier.
+		 */
+		void pushStretchedAudio(std::span<const float> samples, float ratio);
 
 		/**
 		 * @brief Pushes buffer of audio samples to SDL device/stream.
@@ -92,8 +172,15 @@ private:
 	std::unordered_map<unsigned, Stream>
 		audioStreams{};
 
+	// Slot among the devices capturing at once, from 1, kept until destruction.
+	// Any slot past the first tags the capture file names to keep them apart.
+	unsigned captureSlot{};
+
+	bool emplaceStream(unsigned streamID, Stream&& stream);
+
 public:
 	AudioDevice() noexcept = default;
+	~AudioDevice() noexcept;
 
 	AudioDevice(const self&)  = delete;
 	self& operator=(const self&) = delete;
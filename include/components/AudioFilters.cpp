@@ -9,19 +9,32 @@
 
 /*==================================================================*/
 
+static float resistorCapacitance(float sampleRate, float cutoffFreq) noexcept {
+	return 1.0f / (2.0f * float(std::numbers::pi) \
+		* (cutoffFreq ? cutoffFreq : sampleRate * 0.01f));
+}
+
+float lowPassCoefficient(float sampleRate, float cutoffFreq) noexcept {
+	if (sampleRate <= 1.0f) { return 0.0f; }
+	const auto dt{ 1.0f / sampleRate };
+	const auto rc{ resistorCapacitance(sampleRate, cutoffFreq) };
+	return dt / (rc + dt);
+}
+
+float highPassCoefficient(float sampleRate, float cutoffFreq) noexcept {
+	if (sampleRate <= 1.0f) { return 0.0f; }
+	const auto dt{ 1.0f / sampleRate };
+	const auto rc{ resistorCapacitance(sampleRate, cutoffFreq) };
+	return rc / (rc + dt);
+}
+
+/*==================================================================*/
+
 LowPassFilter::LowPassFilter(float sampleRate, float cutoffFreq) noexcept
 	{ setCoefficient(sampleRate, cutoffFreq); }
 
-void LowPassFilter::setCoefficient(float sampleRate, float cutoffFreq) noexcept {
-	if (sampleRate <= 1.0f)
-		{ mCoefficient = 0.0f; }
-	else {
-		const auto dt{ 1.0f / sampleRate };
-		const auto rc{ 1.0f / (2.0f * float(std::numbers::pi) \
-			* (cutoffFreq ? cutoffFreq : sampleRate * 0.01f)) };
-		mCoefficient = dt / (rc + dt);
-	}
-}
+void LowPassFilter::setCoefficient(float sampleRate, float cutoffFreq) noexcept
+	{ mCoefficient = lowPassCoefficient(sampleRate, cutoffFreq); }
 
 float LowPassFilter::filterSample(float sample) noexcept {
 	if (mCoefficient <= 0.0f) { return sample; }
@@ -32,21 +45,23 @@ float LowPassFilter::filterSample(float sample) noexcept {
 	}
 }
 
+void LowPassFilter::filterBlock(float* data, std::size_t size) noexcept {
+	if (mCoefficient <= 0.0f) { return; }
+	// state kept in a register for the whole block
+	const auto a{ mCoefficient };
+	auto last{ mLastSampleI };
+	for (auto i{ 0u }; i < size; ++i)
+		{ data[i] = last += a * (data[i] - last); }
+	mLastSampleI = last;
+}
+
 /*==================================================================*/
 
 HighPassFilter::HighPassFilter(float sampleRate, float cutoffFreq) noexcept
 	{ setCoefficient(sampleRate, cutoffFreq); }
 
-void HighPassFilter::setCoefficient(float sampleRate, float cutoffFreq) noexcept {
-	if (sampleRate <= 1.0f)
-		{ mCoefficient = 0.0f; }
-	else {
-		const auto dt{ 1.0f / sampleRate };
-		const auto rc{ 1.0f / (2.0f * float(std::numbers::pi) \
-			* (cutoffFreq ? cutoffFreq : sampleRate * 0.01f)) };
-		mCoefficient = rc / (rc + dt);
-	}
-}
+void HighPassFilter::setCoefficient(float sampleRate, float cutoffFreq) noexcept
+	{ mCoefficient = highPassCoefficient(sampleRate, cutoffFreq); }
 
 float HighPassFilter::filterSample(float sample) noexcept {
 	if (mCoefficient <= 0.0f) { return sample; }
@@ -57,3 +72,18 @@ float HighPassFilter::filterSample(float sample) noexcept {
 		return output;
 	}
 }
+
+void HighPassFilter::filterBlock(float* data, std::size_t size) noexcept {
+	if (mCoefficient <= 0.0f) { return; }
+	const auto a{ mCoefficient };
+	auto input { mLastSampleI };
+	auto output{ mLastSampleO };
+	for (auto i{ 0u }; i < size; ++i) {
+		const auto sample{ data[i] };
+		output = a * (output + sample - input);
+		input  = sample;
+		data[i] = output;
+	}
+	mLastSampleI = input;
+	mLastSampleO = output;
+}
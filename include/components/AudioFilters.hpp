@@ -6,14 +6,30 @@
 
 #pragma once
 
+#include <array>
+#include <span>
+#include <tuple>
 #include <concepts>
 #include <memory>
 
+#include "Macros.hpp"
+
+/*==================================================================*/
+
+// One-pole smoothing factor of a low-pass at the given cutoff, 0 disables.
+float lowPassCoefficient(float sampleRate, float cutoffFreq) noexcept;
+// One-pole feedback factor of a high-pass at the given cutoff, 0 disables.
+float highPassCoefficient(float sampleRate, float cutoffFreq) noexcept;
+
 /*==================================================================*/
 
 class AudioStreamingFilter {
 	virtual float filterSample(float sample) noexcept = 0;
 
+	// Runs the filter over a block in place, the base version goes sample by sample.
+	virtual void filterBlock(float* data, std::size_t size) noexcept
+		{ for (auto i{ 0u }; i < size; ++i) { data[i] = filterSample(data[i]); } }
+
 public:
 	virtual ~AudioStreamingFilter() = default;
 
@@ -23,6 +39,10 @@ public:
 		requires (std::is_integral_v<T> || std::is_floating_point_v<T>)
 	T process(T sample) noexcept
 		{ return static_cast<T>(filterSample(static_cast<float>(sample))); }
+
+	// Filters a whole block in place with a single virtual call.
+	void process(std::span<float> block) noexcept
+		{ filterBlock(block.data(), block.size()); }
 };
 
 /*==================================================================*/
@@ -36,7 +56,7 @@ UniqueFilter make_stream_filter(Args&&... args)
 
 /*==================================================================*/
 
-class LowPassFilter : public AudioStreamingFilter {
+class LowPassFilter final : public AudioStreamingFilter {
 	float mLastSampleI{};
 	float mCoefficient{};
 
@@ -46,11 +66,12 @@ public:
 	void setCoefficient(float sampleRate, float cutoffFreq = 0.0f) noexcept override;
 
 	float filterSample(float sample) noexcept override;
+	void  filterBlock(float* data, std::size_t size) noexcept override;
 };
 
 /*==================================================================*/
 
-class HighPassFilter : public AudioStreamingFilter {
+class HighPassFilter final : public AudioStreamingFilter {
 	float mLastSampleI{};
 	float mLastSampleO{};
 	float mCoefficient{};
@@ -61,4 +82,106 @@ public:
 	void setCoefficient(float sampleRate, float cutoffFreq = 0.0f) noexcept override;
 
 	float filterSample(float sample) noexcept override;
+	void  filterBlock(float* data, std::size_t size) noexcept override;
+};
+
+/*==================================================================*/
+
+/**
+ * @brief Chain of concrete filters applied in a single pass over a block,
+ *        each sample going through every stage before the next is read.
+ *        Stages are called non-virtually, the filter types being final.
+ */
+template <typename... Filters>
+	requires (std::is_base_of_v<AudioStreamingFilter, Filters> && ...)
+class FilterCascade {
+	std::tuple<Filters...> mStages;
+
+public:
+	FilterCascade(Filters... stages) noexcept
+		: mStages{ std::move(stages)... }
+	{}
+
+	template <std::size_t I>
+	auto& stage() noexcept { return std::get<I>(mStages); }
+
+	void process(std::span<float> block) noexcept {
+		std::apply([block](auto&... stages) noexcept {
+			for (auto& sample : block)
+				{ ((sample = stages.filterSample(sample)), ...); }
+		}, mStages);
+	}
+};
+
+/*==================================================================*/
+
+/**
+ * @brief Low-pass over N interleaved channels (or N separate streams laid out
+ *        frame by frame), keeping per-channel state side by side so the inner
+ *        channel loop can vectorize across channels.
+ */
+template <std::size_t Channels>
+class LowPassBank {
+	std::array<float, Channels> mLastSampleI{};
+	float mCoefficient{};
+
+public:
+	LowPassBank(float sampleRate, float cutoffFreq = 0.0f) noexcept
+		{ setCoefficient(sampleRate, cutoffFreq); }
+
+	void setCoefficient(float sampleRate, float cutoffFreq = 0.0f) noexcept
+		{ mCoefficient = lowPassCoefficient(sampleRate, cutoffFreq); }
+
+	// Filters interleaved frames in place, trailing partial frames are left as-is.
+	void process(std::span<float> frames) noexcept {
+		if (mCoefficient <= 0.0f) { return; }
+		const auto a{ mCoefficient };
+		auto state{ mLastSampleI };
+
+		for (auto f{ 0u }; f + Channels <= frames.size(); f += Channels) {
+			SUGGEST_VECTORIZABLE_LOOP
+			for (auto c{ 0u }; c < Channels; ++c) {
+				state[c] += a * (frames[f + c] - state[c]);
+				frames[f + c] = state[c];
+			}
+		}
+		mLastSampleI = state;
+	}
+};
+
+/**
+ * @brief High-pass (DC blocker) over N interleaved channels, see LowPassBank.
+ */
+template <std::size_t Channels>
+class HighPassBank {
+	std::array<float, Channels> mLastSampleI{};
+	std::array<float, Channels> mLastSampleO{};
+	float mCoefficient{};
+
+public:
+	HighPassBank(float sampleRate, float cutoffFreq = 0.0f) noexcept
+		{ setCoefficient(sampleRate, cutoffFreq); }
+
+	void setCoefficient(float sampleRate, float cutoffFreq = 0.0f) noexcept
+		{ mCoefficient = highPassCoefficient(sampleRate, cutoffFreq); }
+
+	// Filters interleaved frames in place, trailing partial frames are left as-is.
+	void process(std::span<float> frames) noexcept {
+		if (mCoefficient <= 0.0f) { return; }
+		const auto a{ mCoefficient };
+		auto input { mLastSampleI };
+		auto output{ mLastSampleO };
+
+		for (auto f{ 0u }; f + Channels <= frames.size(); f += Channels) {
+			SUGGEST_VECTORIZABLE_LOOP
+			for (auto c{ 0u }; c < Channels; ++c) {
+				const auto sample{ frames[f + c] };
+				output[c] = a * (output[c] + sample - input[c]);
+				input[c]  = sample;
+				frames[f + c] = output[c];
+			}
+		}
+		mLastSampleI = input;
+		mLastSampleO = output;
+	}
 };
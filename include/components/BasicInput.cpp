@@ -5,20 +5,134 @@
 */
 
 #include <algorithm>
+#include <optional>
+#include <atomic>
+
+#include <atomic_queue/atomic_queue.h>
 
 #include "BasicInput.hpp"
 #include "ExecPolicy.hpp"
 
+#include <SDL3/SDL_timer.h>
+
 /*==================================================================*/
 
-void BasicKeyboard::updateStates() noexcept {
-	std::copy_n(EXEC_POLICY(unseq)
-		mCurState, TOTALKEYS, mOldState);
+struct BasicKeyboard::EventQueue {
+	struct Event {
+		Uint64 time;
+		SDL_Scancode key;
+		bool down;
+	};
+
+	using Ring = atomic_queue::AtomicQueueB2<Event,
+		std::allocator<Event>, true, false, true>;
+
+	Ring events{ 256 };
+
+	// Key states coalesced while the ring was full, 0 for none, else 1 + down.
+	std::atomic<unsigned char> overflow[TOTALKEYS]{};
+	std::atomic<int> overflowed{}; // keys with a coalesced state waiting
+
+	// Consumer side: popped already, but stamped past what was applied so far.
+	std::optional<Event> held;
+};
+
+BasicKeyboard::BasicKeyboard(Source source) {
+	if (source == Source::EVENTS)
+		{ mQueue = std::make_unique<EventQueue>(); }
+}
+
+BasicKeyboard::~BasicKeyboard() noexcept = default;
+
+/*==================================================================*/
+
+void BasicKeyboard::updateStates(Uint64 framePeriodNS) noexcept {
+	std::transform(EXEC_POLICY(unseq)
+		mCurState, mCurState + TOTALKEYS, mTapState, mOldState,
+		[](bool held, bool tapped) noexcept { return held || tapped; });
+	std::fill_n(EXEC_POLICY(unseq)
+		mTapState, TOTALKEYS, false);
+
+	if (mQueue) {
+		const auto now{ SDL_GetTicksNS() };
+
+		if (!framePeriodNS) {
+			mWindowPeriod = 0;
+			applyQueued(now);
+			return;
+		}
+
+		auto windowEnd{ mWindowStart + mWindowPeriod + framePeriodNS };
+		if (mWindowPeriod != framePeriodNS || windowEnd > now + framePeriodNS) {
+			// (re)start the timeline at the first frame, a new framerate, or once turbo
+			// or unpaced frames outran the host clock
+			windowEnd = now;
+		} else if (now >= windowEnd + framePeriodNS) {
+			// the host fell behind, skip the lost periods but stay in phase
+			windowEnd += (now - windowEnd) / framePeriodNS * framePeriodNS;
+		}
+		mWindowPeriod = framePeriodNS;
+		mWindowStart  = windowEnd - framePeriodNS;
+
+		applyQueued(mWindowStart);
+		return;
+	}
 
 	std::copy_n(EXEC_POLICY(unseq)
 		SDL_GetKeyboardState(nullptr), TOTALKEYS, mCurState);
 }
 
+void BasicKeyboard::pushEvent(SDL_Scancode key, bool down, Uint64 time) noexcept {
+	if (!mQueue || key <= SDL_SCANCODE_UNKNOWN || key >= SDL_SCANCODE_COUNT) { return; }
+	auto& queue{ *mQueue };
+
+	// once anything is coalesced, later events follow it there to stay in order
+	if (queue.overflowed.load(std::memory_order_acquire) <= 0
+		&& queue.events.try_push({ time, key, down })) { return; }
+
+	if (!queue.overflow[key].exchange(1 + down, std::memory_order_acq_rel))
+		{ queue.overflowed.fetch_add(1, std::memory_order_release); }
+}
+
+bool BasicKeyboard::applyEvents(unsigned slice, unsigned slices) noexcept {
+	return mQueue && mWindowPeriod && slices
+		&& applyQueued(mWindowStart + mWindowPeriod * slice / slices);
+}
+
+void BasicKeyboard::setKeyState(SDL_Scancode key, bool down) noexcept {
+	mCurState[key] = down;
+	if (down) { mTapState[key] = true; }
+}
+
+bool BasicKeyboard::applyQueued(Uint64 until) noexcept {
+	auto& queue{ *mQueue };
+	auto changed{ false };
+
+	for (EventQueue::Event event;;) {
+		if (!queue.held) {
+			if (!queue.events.try_pop(event)) { break; }
+			queue.held = event;
+		}
+		// coalesced states are newer still, so they wait along with it
+		if (queue.held->time > until) { return changed; }
+
+		setKeyState(queue.held->key, queue.held->down);
+		queue.held.reset();
+		changed = true;
+	}
+
+	if (queue.overflowed.load(std::memory_order_acquire) > 0) {
+		for (auto key{ 0u }; key < TOTALKEYS; ++key) {
+			if (const auto state{ queue.overflow[key].exchange(0, std::memory_order_acq_rel) }) {
+				queue.overflowed.fetch_sub(1, std::memory_order_release);
+				setKeyState(SDL_Scancode(key), state > 1);
+				changed = true;
+			}
+		}
+	}
+	return changed;
+}
+
 void BasicMouse::updateStates() noexcept {
 	mOldState = mCurState;
 
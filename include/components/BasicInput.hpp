@@ -11,6 +11,7 @@
 #include <SDL3/SDL_gamepad.h>
 #include <SDL3/SDL_mouse.h>
 
+#include <memory>
 #include <concepts>
 
 /*==================================================================*/
@@ -29,17 +30,69 @@ enum BIC_Button : unsigned {
 /*==================================================================*/
 	#pragma region BasicKeyboard Class
 
+/**
+ * @brief Keyboard state, either polled from SDL once per updateStates() call, or fed
+ *        by timestamped events that another thread pushes through a lock-free queue.
+ *
+ * @details
+ * In the event-fed mode, updateStates() starts a frame and applies every event
+ * stamped before it. Given the frame period, each frame instead replays one
+ * period of host time, the one that ended as the frame began, along the same
+ * drift-free timeline the frame pacer keeps. The owner then calls applyEvents()
+ * at fixed points of the frame, and each event lands at the point matching its
+ * offset into that period. Input thus trails by exactly one frame, but where it
+ * lands depends only on its timestamp, never on how fast the host runs the frame.
+ * A key pressed at any point of a frame reads as held until that frame ends, so a
+ * tap shorter than a frame still registers.
+ */
 class BasicKeyboard final {
 	static constexpr auto TOTALKEYS{ 0u + SDL_SCANCODE_COUNT };
 
+public:
+	enum class Source { POLLED, EVENTS };
+
+private:
+	struct EventQueue;
+	std::unique_ptr<EventQueue> mQueue;
+
+	Uint64 mWindowStart{};  // SDL_GetTicksNS() time the replayed period starts at
+	Uint64 mWindowPeriod{}; // length of the replayed period, 0 if not replaying
+
 	bool mOldState[TOTALKEYS]{};
 	bool mCurState[TOTALKEYS]{};
+	bool mTapState[TOTALKEYS]{}; // pressed at some point of the current frame
+
+	void setKeyState(SDL_Scancode key, bool down) noexcept;
+	bool applyQueued(Uint64 until) noexcept;
 
 public:
-	void updateStates() noexcept;
+	explicit BasicKeyboard(Source source = Source::POLLED);
+	~BasicKeyboard() noexcept;
+
+	/**
+	 * @brief Starts a new frame. If event-fed and given the frame period in nanoseconds,
+	 *        moves on to the next period of host time and applies the events stamped
+	 *        before it, else applies every event stamped so far.
+	 */
+	void updateStates(Uint64 framePeriodNS = 0) noexcept;
+
+	/**
+	 * @brief Queues a key event, from any single thread. Ignored by a polled keyboard.
+	 *        Should the queue fill up, later events coalesce into the last state of
+	 *        each key until it is drained, so a release is never lost.
+	 * @param[in] time :: Nanosecond timestamp in SDL_GetTicksNS() time, as SDL events carry.
+	 */
+	void pushEvent(SDL_Scancode key, bool down, Uint64 time) noexcept;
+
+	/**
+	 * @brief Applies the queued events stamped up to the given point of the replayed
+	 *        period, slice / slices of the way through it, if event-fed.
+	 * @return Whether any key changed state.
+	 */
+	bool applyEvents(unsigned slice, unsigned slices) noexcept;
 
 	bool isHeldPrev(SDL_Scancode key) const noexcept { return mOldState[key]; }
-	bool isHeld    (SDL_Scancode key) const noexcept { return mCurState[key]; }
+	bool isHeld    (SDL_Scancode key) const noexcept { return mCurState[key] || mTapState[key]; }
 	bool isPressed (SDL_Scancode key) const noexcept { return !isHeldPrev(key) &&  isHeld(key); }
 	bool isReleased(SDL_Scancode key) const noexcept { return  isHeldPrev(key) && !isHeld(key); }
 
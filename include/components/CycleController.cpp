@@ -0,0 +1,65 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <cmath>
+#include <algorithm>
+
+#include "CycleController.hpp"
+
+/*==================================================================*/
+
+CycleController::Settings CycleController::sSettings{};
+
+SettingsMap CycleController::Settings::map() noexcept {
+	return {
+		makeSetting("Core.BenchLoad", &target_load),
+	};
+}
+
+void CycleController::configure(const Settings& settings) noexcept {
+	sSettings.target_load = std::clamp(settings.target_load, 0.1f, 1.0f);
+}
+
+/*==================================================================*/
+
+void CycleController::setTargetLoad(f32 load) noexcept {
+	mTargetLoad = std::clamp(load, 0.1f, 1.0f);
+}
+
+void CycleController::reset() noexcept {
+	mLoad = mThroughput = mLastError = mMIPS = 0.0f;
+	mOutput = 0.0;
+	mPrimed = false;
+}
+
+s32 CycleController::update(s32 cycles, f32 busyMs, f32 budgetMs, f32 periodMs, s32 maxCycles) noexcept {
+	if (cycles <= 0 || busyMs <= 0.0f || budgetMs <= 0.0f) [[unlikely]]
+		{ return cycles; }
+
+	const auto load{ busyMs / budgetMs };
+	const auto throughput{ cycles / busyMs };
+
+	if (!mPrimed) [[unlikely]] {
+		mLoad = load;
+		mThroughput = throughput;
+		mOutput = cycles;
+		mPrimed = true;
+	} else {
+		mLoad += (load - mLoad) * cSmooth;
+		mThroughput += (throughput - mThroughput) * cSmooth;
+	}
+
+	const auto error{ mTargetLoad - mLoad };
+	mOutput += f64(mThroughput * budgetMs) * (cGainP * (error - mLastError) + cGainI * error);
+	mOutput = std::clamp(mOutput, 1.0, f64(std::max(maxCycles, 1)));
+	mLastError = error;
+
+	if (periodMs > 0.0f) {
+		const auto rate{ cycles / periodMs / 1000.0f };
+		mMIPS = mMIPS > 0.0f ? mMIPS + (rate - mMIPS) * cSteady : rate;
+	}
+	return s32(std::lround(mOutput));
+}
@@ -0,0 +1,72 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include "Typedefs.hpp"
+#include "SettingWrapper.hpp"
+
+/*==================================================================*/
+
+/**
+ * @brief PI controller steering cycles per frame towards a target share of
+ *        the frame budget, for running a core as fast as the host allows.
+ *
+ * @details
+ * Both the measured load and the throughput (cycles per ms of busy time) are
+ * smoothed first. The controller runs in velocity form, its output stepping
+ * by the error scaled to cycles through the throughput estimate. Clamping
+ * that output is then all the anti-windup needed, since no integral term is
+ * kept around to saturate.
+ */
+class CycleController final {
+	static constexpr f32 cGainP{ 0.30f };
+	static constexpr f32 cGainI{ 0.25f };
+	static constexpr f32 cSmooth{ 0.30f };
+	static constexpr f32 cSteady{ 1.0f / 32.0f };
+
+public:
+	struct Settings {
+		f32 target_load{ 0.90f }; // share of the frame budget to fill, 0.1 ... 1.0
+
+		SettingsMap map() noexcept;
+	};
+
+private:
+	static Settings sSettings;
+
+	f32 mTargetLoad{ sSettings.target_load };
+	f32 mLoad{};       // smoothed share of the budget spent
+	f32 mThroughput{}; // smoothed cycles per ms of busy time
+	f32 mLastError{};
+	f32 mMIPS{};       // steady-state achieved rate
+	f64 mOutput{};     // unrounded cycles per frame
+	bool mPrimed{};
+
+public:
+	static void configure(const Settings& settings) noexcept;
+	static auto exportSettings() noexcept -> Settings { return sSettings; }
+
+	// Target share of the frame budget, e.g. lower to keep the UI responsive.
+	void setTargetLoad(f32 load) noexcept;
+	auto getTargetLoad() const noexcept { return mTargetLoad; }
+
+	// Forgets all measurements, as after a change of core or mode.
+	void reset() noexcept;
+
+	/**
+	 * @brief Feeds one frame's measurements and returns the next cycles per frame.
+	 * @param[in] cycles   :: Cycles executed in the frame.
+	 * @param[in] busyMs   :: Time spent producing the frame.
+	 * @param[in] budgetMs :: Length of a frame.
+	 * @param[in] periodMs :: Time since the previous frame, for the achieved rate.
+	 * @param[in] maxCycles :: Upper bound of the output.
+	 */
+	s32 update(s32 cycles, f32 busyMs, f32 budgetMs, f32 periodMs, s32 maxCycles) noexcept;
+
+	auto getLoad() const noexcept { return mLoad; }
+	auto getMIPS() const noexcept { return mMIPS; }
+};
@@ -9,12 +9,23 @@
 #include <thread>
 #include <algorithm>
 
+#if defined(__linux__)
+	#include <cerrno>
+	#include <time.h>
+#endif
+
+#include "Macros.hpp"
 #include "FrameLimiter.hpp"
 
+using namespace std::chrono_literals;
+
 /*==================================================================*/
 
-void FrameLimiter::setLimiter(float framerate) noexcept
-	{ timeFrequency = 1000.0f / std::clamp(framerate, 0.5f, 1000.0f); }
+void FrameLimiter::setLimiter(float framerate) noexcept {
+	const auto hertz{ std::clamp(framerate, 0.5f, 1000.0f) };
+	framePeriod   = nanos(std::llround(1e9 / hertz));
+	timeFrequency = std::chrono::duration<float, std::milli>(framePeriod).count();
+}
 
 void FrameLimiter::setLimiter(float framerate, bool firstpass, bool lostframe) noexcept {
 	setLimiter(framerate);
@@ -24,25 +35,60 @@ void FrameLimiter::setLimiter(float framerate, bool firstpass, bool lostframe) n
 
 /*==================================================================*/
 
+void FrameLimiter::sleepUntil(chrono target) noexcept {
+#if defined(__linux__)
+	// steady_clock reads CLOCK_MONOTONIC here, so its epoch can be used as-is
+	const auto ns{ std::chrono::duration_cast<nanos>(target.time_since_epoch()).count() };
+	const timespec wake{ time_t(ns / 1'000'000'000), long(ns % 1'000'000'000) };
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr) == EINTR) {}
+#else
+	std::this_thread::sleep_until(target);
+#endif
+}
+
 bool FrameLimiter::checkTime() {
 	if (isValidFrame()) { return true; }
 
-	if (getRemainder() >= 2.3f)
-		{ std::this_thread::sleep_for(millis(1)); }
-	else
-		{ std::this_thread::yield(); }
+	if (const auto wakeAt{ timeDeadline - spinWindow }; clock::now() < wakeAt) {
+		sleepUntil(wakeAt);
+
+		// oversleep past the target tunes how early the next sleep has to end
+		const auto oversleep{ std::max(clock::now() - wakeAt, clock::duration::zero()) };
+		wakeLatency += (std::chrono::duration_cast<nanos>(oversleep) - wakeLatency) / 8;
+		spinWindow = std::clamp<nanos>(wakeLatency * 2 + 50us,
+			100us, std::min<nanos>(4ms, framePeriod / 2));
+
+		// woken far too early, leave it to the next poll
+		if (timeDeadline - clock::now() > spinWindow * 2) { return false; }
+	}
+
+	while (clock::now() < timeDeadline) { CPU_RELAX(); }
+	return isValidFrame();
+}
+
+void FrameLimiter::markFrame() noexcept {
+	using namespace std::chrono;
+	const auto timeAtCurrent{ clock::now() };
 
-	return false;
+	timeVariation = initTimeCheck
+		? duration<float, std::milli>(timeAtCurrent - timePastFrame).count() : 0.0f;
+	timeOvershoot = 0.0f;
+	lastFrameLost = false;
+	timePastFrame = timeAtCurrent;
+	timeDeadline  = timeAtCurrent + framePeriod;
+	initTimeCheck = true;
+	++validFrameCnt;
 }
 
 /*==================================================================*/
 
 inline bool FrameLimiter::isValidFrame() noexcept {
 	using namespace std::chrono;
-	const auto timeAtCurrent{ steady_clock::now() };
+	const auto timeAtCurrent{ clock::now() };
 
 	if (!initTimeCheck) [[unlikely]] {
 		timePastFrame = timeAtCurrent;
+		timeDeadline  = timeAtCurrent + framePeriod;
 		initTimeCheck = true;
 	}
 
@@ -52,21 +98,28 @@ inline bool FrameLimiter::isValidFrame() noexcept {
 		return true;
 	}
 
-	timeVariation = {
-		timeOvershoot + duration<float, std::milli>
-		(timeAtCurrent - timePastFrame).count()
-	};
-
-	if (timeVariation < timeFrequency)
+	if (timeAtCurrent < timeDeadline)
 		[[likely]] { return false; }
 
+	auto timeLate{ duration_cast<nanos>(timeAtCurrent - timeDeadline) };
+
 	if (skipLostFrame) {
-		lastFrameLost = timeVariation >= timeFrequency + 0.050f;
-		timeOvershoot = std::fmod(timeVariation, timeFrequency);
-	} else {
-		timeOvershoot = timeVariation - timeFrequency;
+		lastFrameLost = timeLate >= 50us;
+		if (timeLate >= framePeriod) {
+			// drop the frames missed entirely, staying in phase with the timeline
+			const auto missed{ timeLate / framePeriod };
+			timeDeadline += framePeriod * missed;
+			timeLate     -= framePeriod * missed;
+		}
+	} else if (timeLate >= 1s) {
+		// too far behind to ever catch up, start a new timeline
+		timeDeadline = timeAtCurrent;
+		timeLate     = nanos::zero();
 	}
 
+	timeOvershoot = duration<float, std::milli>(timeLate).count();
+	timeVariation = duration<float, std::milli>(timeAtCurrent - timePastFrame).count();
+	timeDeadline += framePeriod;
 	timePastFrame = timeAtCurrent;
 	++validFrameCnt;
 	return true;
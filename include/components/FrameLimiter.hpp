@@ -10,8 +10,17 @@
 
 /*==================================================================*/
 
+/**
+ * @brief Paces frames against an absolute deadline timeline kept in integer
+ *        nanoseconds, so no rounding error accumulates from frame to frame.
+ *        Waiting sleeps until shortly before the deadline, then spins on a
+ *        pause instruction for the rest. The spin window is sized from the
+ *        measured wakeup latency of the sleeps.
+ */
 class FrameLimiter final {
-	using chrono = std::chrono::steady_clock::time_point;
+	using clock  = std::chrono::steady_clock;
+	using chrono = clock::time_point;
+	using nanos  = std::chrono::nanoseconds;
 	using millis = std::chrono::milliseconds;
 	using uint64 = unsigned long long;
 
@@ -21,14 +30,20 @@ class FrameLimiter final {
 	bool   lastFrameLost{}; // missed frame indicator when frameskip is enabled
 
 	float  timeFrequency{}; // holds time (ms) per unit Hertz
-	float  timeOvershoot{}; // holds time remainder (ms) from last successful check
-	float  timeVariation{}; // holds time difference between last check and now
-	chrono timePastFrame{}; // holds timestamp of the last frame's check
+	float  timeOvershoot{}; // holds time (ms) the last frame started past its deadline
+	float  timeVariation{}; // holds time (ms) between the last two valid frames
+	chrono timePastFrame{}; // holds timestamp of the last valid frame
+	chrono timeDeadline{};  // holds timestamp the next frame is due at
+	nanos  framePeriod{};   // exact frame period, the timeline's unit
+	nanos  spinWindow{ std::chrono::microseconds(500) }; // final stretch spent spinning
+	nanos  wakeLatency{ std::chrono::microseconds(100) }; // smoothed sleep oversleep
 	uint64 validFrameCnt{}; // counter of successful frame checks performed
 
 	inline bool isValidFrame() noexcept;
+	void sleepUntil(chrono target) noexcept;
+
 	inline auto getElapsedTime() const noexcept
-		{ return std::chrono::steady_clock::now() - timePastFrame; }
+		{ return clock::now() - timePastFrame; }
 
 /*==================================================================*/
 
@@ -45,6 +60,7 @@ public:
 		: skipFirstPass{ other.skipFirstPass }
 		, skipLostFrame{ other.skipLostFrame }
 		, timeFrequency{ other.timeFrequency }
+		, framePeriod  { other.framePeriod   }
 	{}
 
 	void setLimiter(float framerate) noexcept;
@@ -52,8 +68,20 @@ public:
 
 /*==================================================================*/
 
+	/**
+	 * @brief Returns true once the next frame is due. Otherwise waits towards
+	 *        the deadline (sleeping, or spinning once inside the spin window)
+	 *        and returns whether it has been reached, so callers can keep
+	 *        polling it in a loop.
+	 */
 	bool checkTime();
 
+	/**
+	 * @brief Starts a frame right away, for callers running unpaced. The frame
+	 *        timings then measure the real frame rate, and no frame counts as late.
+	 */
+	void markFrame() noexcept;
+
 	auto getElapsedMillisSince() const noexcept {
 		using namespace std::chrono;
 		return duration_cast<milliseconds>(getElapsedTime()).count();
@@ -69,6 +97,7 @@ public:
 	auto getValidFrameCounter() const noexcept { return validFrameCnt; }
 	auto getElapsedMillisLast() const noexcept { return timeVariation; }
 	auto getFramespan()         const noexcept { return timeFrequency; }
+	auto getFramePeriod()       const noexcept { return uint64(framePeriod.count()); }
 	auto getOvershoot()         const noexcept { return timeOvershoot; }
 	auto getRemainder()         const noexcept { return timeFrequency - timeVariation; }
 	auto getPercentage()        const noexcept { return timeVariation / timeFrequency; }
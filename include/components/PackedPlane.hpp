@@ -0,0 +1,137 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <algorithm>
+
+/*==================================================================*/
+
+/**
+ * @brief Monochrome display plane of up to 128 columns, with each row packed
+ *        MSB-first into two 64-bit words (column 0 is the top bit of word 0).
+ *        Sprite rows are positioned once and then XOR'd in as whole words.
+ *
+ * @tparam MaxRows :: Row capacity of the plane.
+ */
+template <std::size_t MaxRows>
+class PackedPlane final {
+	using u64 = std::uint64_t;
+	using u32 = std::uint32_t;
+	using s32 = std::int32_t;
+
+public:
+	using Row = std::array<u64, 2>;
+
+private:
+	std::array<Row, MaxRows> mRows{};
+
+	s32 mW{ 128 }; // active width, 64 or 128
+	s32 mH{ MaxRows };
+
+	constexpr s32 words() const noexcept { return mW >> 6; }
+
+public:
+	constexpr PackedPlane(s32 W = 128, s32 H = MaxRows) noexcept
+		{ resize(W, H); }
+
+	constexpr s32 lenX() const noexcept { return mW; }
+	constexpr s32 lenY() const noexcept { return mH; }
+
+	/** @brief Sets the active width (64 or 128) and height, clearing all rows. */
+	constexpr void resize(s32 W, s32 H) noexcept {
+		mW = W > 64 ? 128 : 64;
+		mH = std::clamp<s32>(H, 0, MaxRows);
+		clear();
+	}
+
+	constexpr void clear() noexcept { mRows.fill(Row{}); }
+
+	constexpr bool test(s32 X, s32 Y) const noexcept
+		{ return mRows[Y][X >> 6] >> (~X & 63) & 1; }
+
+	constexpr const Row& operator[](s32 Y) const noexcept { return mRows[Y]; }
+	constexpr       Row& operator[](s32 Y)       noexcept { return mRows[Y]; }
+
+	/**
+	 * @brief Positions a sprite row so its leftmost bit lands on column X.
+	 *        Bits past the right edge are dropped, or wrapped to column 0.
+	 *
+	 * @param[in] bits  :: Sprite row, right-aligned, leftmost pixel in the MSB.
+	 * @param[in] width :: Bit width of the sprite row, at most 64.
+	 * @param[in] X     :: Starting column, must be within the active width.
+	 * @param[in] wrap  :: Whether overflowing bits wrap around.
+	 */
+	constexpr Row place(u64 bits, s32 width, s32 X, bool wrap = false) const noexcept {
+		const auto top { bits << (64 - width) };
+		const auto word{ X >> 6 };
+		const auto bit { X & 63 };
+
+		Row row{};
+		row[word] = top >> bit;
+		if (bit) {
+			const auto spill{ top << (64 - bit) };
+			if (word + 1 < words()) { row[word + 1] = spill; }
+			else if (wrap) { row[0] |= spill; }
+		}
+		return row;
+	}
+
+	/** @brief XORs a positioned sprite row into row Y, returning whether any lit pixel was hit. */
+	constexpr bool toggle(s32 Y, const Row& sprite) noexcept {
+		auto& row{ mRows[Y] };
+		const bool collided{ ((row[0] & sprite[0]) | (row[1] & sprite[1])) != 0 };
+		row[0] ^= sprite[0];
+		row[1] ^= sprite[1];
+		return collided;
+	}
+
+	/**
+	 * @brief Writes each pixel's lit state into bit 3 of a byte buffer of
+	 *        lenX() * lenY() elements, keeping the lower (trail) bits intact.
+	 */
+	constexpr void mergeInto(std::uint8_t* dest) const noexcept {
+		for (auto Y{ 0 }; Y < mH; ++Y) {
+			for (auto X{ 0 }; X < mW; ++X, ++dest) {
+				*dest = std::uint8_t((*dest & 0x7) | test(X, Y) << 3);
+			}
+		}
+	}
+
+	/** @brief Shifts all rows down by N, clearing the rows vacated at the top. */
+	constexpr void shiftDown(s32 N) noexcept {
+		if (N <= 0) { return; }
+		if (N >= mH) { clear(); return; }
+		std::copy_backward(mRows.begin(), mRows.begin() + mH - N, mRows.begin() + mH);
+		std::fill_n(mRows.begin(), N, Row{});
+	}
+
+	/** @brief Shifts all rows left by N columns (N < 64), clearing from the right edge. */
+	constexpr void shiftLeft(s32 N) noexcept {
+		for (auto Y{ 0 }; Y < mH; ++Y) {
+			auto& row{ mRows[Y] };
+			if (words() == 2) {
+				row[0] = row[0] << N | row[1] >> (64 - N);
+				row[1] <<= N;
+			} else {
+				row[0] <<= N;
+			}
+		}
+	}
+
+	/** @brief Shifts all rows right by N columns (N < 64), clearing from the left edge. */
+	constexpr void shiftRight(s32 N) noexcept {
+		for (auto Y{ 0 }; Y < mH; ++Y) {
+			auto& row{ mRows[Y] };
+			if (words() == 2) {
+				row[1] = row[1] >> N | row[0] << (64 - N);
+			}
+			row[0] >>= N;
+		}
+	}
+};
@@ -0,0 +1,58 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+/*==================================================================*/
+
+/**
+ * @brief Integer audio timeline tied to the emulated frame count.
+ *
+ * @details
+ * The framerate is held as an exact count of millihertz, so the number of
+ * samples up to frame N is always floor(N * freq * 1000 / rate), and each
+ * frame emits the difference. The split therefore only depends on how many
+ * frames were emulated, never on host timing or float accumulation, and
+ * any run of the same frames yields the same audio. Changing either rate
+ * re-anchors the timeline at the current frame.
+ */
+class SampleClock {
+	using u64 = std::uint64_t;
+
+	u64 mFreq{};     // samples per second
+	u64 mRate{};     // frames per 1000 seconds
+	u64 mFrames{};   // frames since the last re-anchor
+	u64 mEmitted{};  // samples since the last re-anchor
+	u64 mTotal{};    // samples over the clock's whole life
+
+public:
+	/**
+	 * @brief Advances by one frame, returning the sample count it emits.
+	 * @param[in] freq      :: Sample rate of the stream.
+	 * @param[in] framerate :: Emulated frames per second.
+	 */
+	unsigned nextFrame(unsigned freq, float framerate) noexcept {
+		const auto rate{ u64(std::llround(framerate * 1000.0)) };
+		if (!rate) { return 0u; }
+
+		if (rate != mRate || freq != mFreq) {
+			mRate = rate; mFreq = freq;
+			mFrames = mEmitted = 0;
+		}
+
+		const auto target{ ++mFrames * mFreq * 1000u / mRate };
+		const auto count { target - mEmitted };
+		mEmitted = target;
+		mTotal  += count;
+		return unsigned(count);
+	}
+
+	// Samples emitted over the clock's whole life, the position on the timeline.
+	u64 getPosition() const noexcept { return mTotal; }
+};
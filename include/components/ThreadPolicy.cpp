@@ -0,0 +1,99 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <algorithm>
+
+#include "ThreadPolicy.hpp"
+#include "Millis.hpp"
+#include "BasicLogger.hpp"
+
+#include <SDL3/SDL_thread.h>
+
+/*==================================================================*/
+
+ThreadPolicy::Settings ThreadPolicy::sSettings{};
+
+SettingsMap ThreadPolicy::Settings::map() noexcept {
+	return {
+		makeSetting("Core.CpuSet", &cpu_set),
+		makeSetting("Core.Scheduler", &scheduler),
+		makeSetting("Core.Priority", &priority),
+		makeSetting("Core.AffinityRefresh", &refresh_ms),
+		makeSetting("Core.PinCooldown", &pin_cooldown),
+	};
+}
+
+void ThreadPolicy::configure(const Settings& settings) noexcept {
+	sSettings = settings;
+	sSettings.refresh_ms = std::min(sSettings.refresh_ms, 60'000u);
+}
+
+/*==================================================================*/
+
+void ThreadPolicy::apply() noexcept {
+	using namespace thread_affinity;
+
+	const auto cores{ get_logical_core_count() };
+	const auto valid{ cores >= 64 ? ~0ull : (1ull << cores) - 1 };
+
+	auto allowed{ (sSettings.cpu_set.empty()
+		? ~0b11ull : parse_cpu_list(sSettings.cpu_set)) & valid };
+
+	if (!allowed) [[unlikely]] {
+		if (!sSettings.cpu_set.empty()) {
+			blog.newEntry(BLOG::WARN, "CPU set \"{}\" matches no available core, using all {}.",
+				sSettings.cpu_set, cores);
+		}
+		allowed = valid;
+	}
+	if (allowed != valid && !set_affinity(allowed)) {
+		blog.newEntry(BLOG::WARN, "Failed to restrict core thread to CPU set \"{}\".",
+			sSettings.cpu_set);
+	}
+
+	if (sSettings.refresh_ms) {
+		mPinning.emplace(sSettings.pin_cooldown, ~allowed);
+	}
+
+	const auto& sched{ sSettings.scheduler };
+	if (sched == "fifo" || sched == "rr") {
+		mStats.realtime = set_realtime_policy(sched == "rr", sSettings.priority);
+		if (!mStats.realtime) {
+			blog.newEntry(BLOG::WARN, "Realtime scheduler \"{}\" refused, "
+				"falling back to time-critical priority.", sched);
+		}
+	} else if (sched != "normal") {
+		blog.newEntry(BLOG::WARN, "Unknown scheduler \"{}\", expected normal, fifo or rr.", sched);
+	}
+	if (!mStats.realtime) {
+		SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+	}
+
+	mStats.core = get_current_core();
+	mNextRefresh = mNextWindow = Millis::now();
+}
+
+void ThreadPolicy::update(f32 wakeupLate) noexcept {
+	const auto lateUs{ wakeupLate * 1000.0f };
+	mStats.jitterMean += (lateUs - mStats.jitterMean) / 16.0f;
+	mWindowPeak = std::max(mWindowPeak, lateUs);
+
+	if (const auto core{ thread_affinity::get_current_core() }; core != mStats.core) {
+		mStats.core = core;
+		++mStats.migrations;
+	}
+
+	const auto now{ Millis::now() };
+	if (now >= mNextWindow) {
+		mStats.jitterPeak = mWindowPeak;
+		mWindowPeak = 0.0f;
+		mNextWindow = now + 1000;
+	}
+	if (mPinning && now >= mNextRefresh) {
+		mPinning->refresh_affinity();
+		mNextRefresh = now + sSettings.refresh_ms;
+	}
+}
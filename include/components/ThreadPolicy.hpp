@@ -0,0 +1,75 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <optional>
+
+#include "Typedefs.hpp"
+#include "SettingWrapper.hpp"
+#include "ThreadAffinity.hpp"
+
+/*==================================================================*/
+
+/**
+ * @brief Scheduling and affinity policy of an emulation core thread.
+ *
+ * @details
+ * The policy is configured once from the settings file and applied by each
+ * core thread to itself on entry: the allowed CPU set, then the scheduling
+ * class, falling back to SDL's time-critical priority when a realtime class
+ * is refused. Afterwards, update() is called once per emulated frame to feed
+ * the monitoring stats, while core group pinning is only re-evaluated every
+ * `refresh_ms` so the frame loop doesn't poll the scheduler.
+ */
+class ThreadPolicy final {
+public:
+	struct Settings {
+		Str cpu_set{};                // e.g. "2-5,8", empty avoids CPUs 0-1
+		Str scheduler{ "normal" };    // normal, fifo or rr
+		s32 priority{ 10 };           // realtime priority for fifo/rr
+		u32 refresh_ms{ 250 };        // pinning check interval, 0 disables pinning
+		u32 pin_cooldown{ 15 };       // seconds a core group stays pinned
+
+		SettingsMap map() noexcept;
+	};
+
+	struct Stats {
+		u32  core{};       // logical core the thread was last seen on
+		u64  migrations{}; // core changes seen between frames
+		f32  jitterMean{}; // smoothed lateness of frame wakeups, in µs
+		f32  jitterPeak{}; // worst lateness over the last second, in µs
+		bool realtime{};   // whether a realtime class was granted
+	};
+
+private:
+	static Settings sSettings;
+
+	std::optional<thread_affinity::Manager> mPinning;
+
+	long long mNextRefresh{};
+	long long mNextWindow{};
+	f32       mWindowPeak{};
+
+	Stats mStats{};
+
+public:
+	static void configure(const Settings& settings) noexcept;
+	static auto exportSettings() noexcept -> Settings { return sSettings; }
+
+	/**
+	 * @brief Applies the configured CPU set and scheduling class to the calling thread.
+	 */
+	void apply() noexcept;
+
+	/**
+	 * @brief Per-frame bookkeeping, call once after each emulated frame.
+	 * @param[in] wakeupLate :: How late the frame started past its deadline, in ms.
+	 */
+	void update(f32 wakeupLate) noexcept;
+
+	const Stats& getStats() const noexcept { return mStats; }
+};
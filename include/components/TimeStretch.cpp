@@ -0,0 +1,94 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+
+#include "TimeStretch.hpp"
+
+/*==================================================================*/
+
+template <std::size_t N>
+static const auto sHannWindow{ []() noexcept {
+	// periodic Hann, halves at 50% overlap sum to exactly 1
+	std::array<float, N> window{};
+	for (auto i{ 0u }; i < N; ++i) {
+		window[i] = 0.5f - 0.5f * std::cos(2.0f * std::numbers::pi_v<float> * i / N);
+	}
+	return window;
+}() };
+
+/*==================================================================*/
+
+TimeStretch::TimeStretch()
+	: mOverlap(cOutputHop, 0.0f)
+{
+	mInput.reserve(cGrainSize * 8);
+	mOutput.reserve(cGrainSize * 4);
+}
+
+void TimeStretch::reset() noexcept {
+	mInput.clear();
+	std::fill(mOverlap.begin(), mOverlap.end(), 0.0f);
+	mInputPos = mDecimate = 0.0;
+}
+
+std::span<const float> TimeStretch::process(std::span<const float> input, float ratio) {
+	mOutput.clear();
+
+	if (ratio >= cDecimateRatio) {
+		// the grain tail left by overlap-add doesn't fit the slice crossfade
+		if (!mDecimating) { reset(); mDecimating = true; }
+		processDecimation(input, ratio);
+	} else {
+		mDecimating = false;
+		mInput.insert(mInput.end(), input.begin(), input.end());
+		processOverlapAdd(std::max(ratio, 0.05f));
+	}
+	return mOutput;
+}
+
+void TimeStretch::processOverlapAdd(float ratio) {
+	const auto& window{ sHannWindow<cGrainSize> };
+	const auto inputHop{ cOutputHop * double(ratio) };
+
+	while (mInputPos + cGrainSize <= mInput.size()) {
+		const auto* grain{ mInput.data() + std::size_t(mInputPos) };
+
+		for (auto i{ 0u }; i < cOutputHop; ++i)
+			{ mOutput.push_back(mOverlap[i] + grain[i] * window[i]); }
+		for (auto i{ 0u }; i < cOutputHop; ++i)
+			{ mOverlap[i] = grain[cOutputHop + i] * window[cOutputHop + i]; }
+
+		mInputPos += inputHop;
+	}
+
+	const auto consumed{ std::min(std::size_t(mInputPos), mInput.size()) };
+	mInput.erase(mInput.begin(), mInput.begin() + consumed);
+	mInputPos -= double(consumed);
+}
+
+void TimeStretch::processDecimation(std::span<const float> input, float ratio) {
+	mDecimate += input.size() / double(ratio);
+	const auto count{ std::min(std::size_t(mDecimate), input.size()) };
+	mDecimate -= double(count);
+
+	// keep the head of each block, its start crossfaded into the samples that
+	// followed the previous slice, so the seams neither click nor dip in level
+	const auto& window{ sHannWindow<cFadeSize * 2> };
+
+	for (auto i{ 0u }; i < count; ++i) {
+		mOutput.push_back(i < cFadeSize
+			? mOverlap[i] + input[i] * window[i]
+			: input[i]);
+	}
+	for (auto i{ 0u }; i < cFadeSize; ++i) {
+		const auto pos{ count + i };
+		mOverlap[i] = pos < input.size() ? input[pos] * window[cFadeSize + i] : 0.0f;
+	}
+}
@@ -0,0 +1,58 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+/*==================================================================*/
+
+/**
+ * @brief Streaming, pitch-preserving time-stretch for mono audio.
+ *
+ * @details
+ * Input recorded at emulated speed is compressed (or expanded) by a tempo
+ * ratio using windowed overlap-add: Hann grains are read from the input at
+ * a hop of `ratio` times the output hop and summed at 50% overlap. Above
+ * cDecimateRatio the grains would barely overlap anyway, so the stage falls
+ * back to keeping a short slice of each input block instead, crossfading
+ * its head into the tail that followed the previous slice.
+ */
+class TimeStretch {
+	static constexpr unsigned cGrainSize{ 512 };
+	static constexpr unsigned cOutputHop{ cGrainSize / 2 };
+	static constexpr unsigned cFadeSize { 32 };
+
+public:
+	static constexpr float cDecimateRatio{ 4.0f };
+
+private:
+	std::vector<float> mInput;    // pending input, consumed from the front
+	std::vector<float> mOverlap;  // second half of the last grain, or tail of the last slice
+	std::vector<float> mOutput;   // samples produced by the last call
+
+	double mInputPos{};  // read position of the next grain in mInput
+	double mDecimate{};  // fractional carry of the decimation mode
+	bool   mDecimating{};
+
+	void processOverlapAdd(float ratio);
+	void processDecimation(std::span<const float> input, float ratio);
+
+public:
+	TimeStretch();
+
+	// Drops any buffered audio, as after a discontinuity.
+	void reset() noexcept;
+
+	/**
+	 * @brief Feeds a block of input and returns the stretched output available so far.
+	 * @param[in] input :: Samples at emulated speed.
+	 * @param[in] ratio :: Tempo ratio, > 1 plays faster. Output size trends to input / ratio.
+	 * @return View of internal storage, valid until the next call.
+	 */
+	std::span<const float> process(std::span<const float> input, float ratio);
+};
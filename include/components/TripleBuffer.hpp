@@ -200,6 +200,28 @@ public:
 			acquireReadBuffer(), clamp_count(count), output);
 	}
 
+	/**
+	 * @brief Copies contents from the TripleBuffer into the provided output array,
+	 *        applying a unary transformation to each element.
+	 *
+	 * @tparam T2 Type of the output elements.
+	 * @tparam Lambda Unary function applied to each buffer element before storing.
+	 * @param output Pointer to the output array where elements will be written.
+	 * @param count Number of elements to read; if zero, reads the entire buffer.
+	 * @param function Transformation function applied to each element.
+	 *
+	 * @note Acquires a shared lock on the read buffer.
+	 */
+	template <typename T2, typename Lambda>
+	void read(T2* output, size_type count, Lambda&& function)
+		requires(std::is_trivially_copyable_v<T2>)
+	{
+		std::shared_lock lock{ mReadLock };
+		const auto input{ acquireReadBuffer() };
+		std::transform(EXEC_POLICY(unseq)
+			input, input + clamp_count(count), output, function);
+	}
+
 	/**
 	 * @brief Copies contents from the TripleBuffer into a contiguous container.
 	 *
@@ -249,6 +271,27 @@ public:
 		commitWorkerChanges();
 	}
 
+	/**
+	 * @brief Writes to the TripleBuffer by copying data from a raw pointer.
+	 *
+	 * @tparam T2 Type of the input data elements.
+	 * @param data Pointer to the source data.
+	 * @param count Number of elements to write. Maximum is clamped to the buffer size.
+	 *
+	 * @note Acquires an exclusive lock on the work buffer.
+	 */
+	template <typename T2>
+	void write(const T2* data, size_type count)
+		noexcept(std::is_nothrow_convertible_v<T2, T1>)
+		requires(std::is_trivially_copyable_v<T2>&& std::is_convertible_v<T2, T1>)
+	{
+		std::unique_lock lock{ mWorkLock };
+		std::copy_n(EXEC_POLICY(unseq)
+			data, clamp_count(count), mpWork->get());
+
+		commitWorkerChanges();
+	}
+
 	/**
 	 * @brief Writes to the TripleBuffer by copying data from a contiguous container.
 	 *
@@ -295,6 +338,7 @@ public:
 	 * @brief Writes to the TripleBuffer by applying a binary transformation to elements from two contiguous containers.
 	 *
 	 * @tparam T2 A contiguous container type.
+	 * @tparam T3 A contiguous container type, may differ from T2. Must be at least as large as T2.
 	 * @tparam Lambda Binary function applied to corresponding elements from both containers before writing.
 	 * @param data1 The first input container.
 	 * @param data2 The second input container.
@@ -302,10 +346,10 @@ public:
 	 *
 	 * @note Acquires an exclusive lock on the work buffer.
 	 */
-	template <IsContiguousContainer T2, typename Lambda>
-	void write(const T2& data1, const T2& data2, Lambda&& function)
+	template <IsContiguousContainer T2, IsContiguousContainer T3, typename Lambda>
+	void write(const T2& data1, const T3& data2, Lambda&& function)
 		noexcept(std::is_nothrow_convertible_v<ValueType<T2>, T1>)
-		requires(std::is_trivially_copyable_v<ValueType<T2>>&& std::is_convertible_v<ValueType<T2>, T1>)
+		requires(std::is_trivially_copyable_v<ValueType<T2>> && std::is_trivially_copyable_v<ValueType<T3>>)
 	{
 		std::unique_lock lock{ mWorkLock };
 		std::transform(EXEC_POLICY(unseq)
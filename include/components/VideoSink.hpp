@@ -0,0 +1,135 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Typedefs.hpp"
+#include "AtomSharedPtr.hpp"
+#include "TripleBuffer.hpp"
+#include "EzMaths.hpp"
+#include "ColorOps.hpp"
+#include "SHA1.hpp"
+
+/*==================================================================*/
+
+/**
+ * @brief Video output of a single core instance. The core thread writes frames
+ *        and display parameters here, the frontend reads them back for drawing.
+ *        Every member is safe to use from both sides concurrently.
+ */
+class VideoSink final {
+
+public:
+	struct Viewport {
+		ez::Frame frame{};
+		s32 multi{}, pxpad{};
+
+		constexpr Viewport(s32 w = 0, s32 h = 0, s32 multi = 0, s32 pxpad = 0) noexcept
+			: frame{ std::clamp(w, 0x0, 0xFFF), std::clamp(h, 0x0, 0xFFF) }
+			, multi{ std::clamp(multi, 0x1, 0xF) }
+			, pxpad{ std::clamp(pxpad, 0x0, 0xF) }
+		{}
+
+		constexpr auto rotate_if(bool cond) const noexcept {
+			return cond
+				? Viewport{ frame.h, frame.w, multi, pxpad }
+				: Viewport{ frame.w, frame.h, multi, pxpad };
+		}
+
+		constexpr auto scaled() const noexcept {
+			return ez::Frame{ frame.w * multi, frame.h * multi };
+		}
+		constexpr auto padded() const noexcept {
+			return ez::Frame{ frame.w * multi + pxpad * 2, frame.h * multi + pxpad * 2 };
+		}
+
+		static constexpr auto pack(s32 w, s32 h, s32 multi, s32 pxpad) noexcept {
+			return ((u32(w)     & 0xFFFu) <<  0) |
+				   ((u32(h)     & 0xFFFu) << 12) |
+				   ((u32(multi) & 0xFu)   << 24) |
+				   ((u32(pxpad) & 0xFu)   << 28);
+		}
+
+		static constexpr auto unpack(u32 packed) noexcept {
+			return Viewport{
+				s32((packed >>  0) & 0xFFFu),
+				s32((packed >> 12) & 0xFFFu),
+				s32((packed >> 24) & 0xFu),
+				s32((packed >> 28) & 0xFu)
+			};
+		}
+	};
+
+private:
+	Atom<u32> mViewport{};
+	Atom<u32> mOutlineColor{};
+	Atom<const RGBA*> mIndexedPalette{};
+	Atom<u8>  mTextureAlpha{ 0xFF };
+
+public:
+	TripleBuffer<u32> displayBuffer;
+	TripleBuffer<u8>  indexedBuffer; // used instead of displayBuffer while a palette is set
+
+	// Sizes both frame buffers for a display of the given pixel count.
+	void resize(s32 pixels) {
+		displayBuffer.resize(pixels);
+		indexedBuffer.resize(pixels);
+	}
+
+	/**
+	 * @brief Sets various parameters to shape, scale, and pad the Viewport.
+	 * @param[in] W :: The width of the output texture in pixels.
+	 * @param[in] H :: The height of the output texture in pixels.
+	 * @param[in] mult :: Integer multiplier of the texture size to adjust minimum size. Capped at 16.
+	 * @param[in] ppad :: The thickness of the (colorable) padding surrounding the Viewport in pixels.
+	 */
+	void setViewportSizes(s32 W, s32 H, s32 mult = 0, s32 ppad = 0) noexcept
+		{ mViewport.store(Viewport::pack(W, H, mult, ppad), mo::release); }
+	auto getViewportSizes() const noexcept
+		{ return Viewport::unpack(mViewport.load(mo::acquire)); }
+
+	void setBorderColor(u32 color) noexcept { mOutlineColor.store(color, mo::release); }
+	auto getBorderColor() const    noexcept { return mOutlineColor.load(mo::acquire); }
+
+	/**
+	 * @brief Switches texture uploads to expand indexedBuffer through a 256-entry
+	 *        palette, or back to displayBuffer if nullptr.
+	 * @param[in] palette :: Palette with static storage duration, or nullptr.
+	 */
+	void setIndexedPalette(const RGBA* palette) noexcept { mIndexedPalette.store(palette, mo::release); }
+	auto getIndexedPalette() const              noexcept { return mIndexedPalette.load(mo::acquire); }
+
+	void setViewportAlpha(u32 alpha) noexcept { mTextureAlpha.store(u8(alpha), mo::release); }
+	auto getViewportAlpha() const    noexcept { return mTextureAlpha.load(mo::acquire); }
+
+	/**
+	 * @brief Copies the latest frame into a 32-bit RGBA pixel buffer of at least
+	 *        `pixels` elements, expanding it through the palette if one is set.
+	 */
+	void readFrame(u32* dest, std::size_t pixels) {
+		if (const auto* palette{ getIndexedPalette() }) {
+			indexedBuffer.read(dest, pixels,
+				[palette](u8 index) noexcept { return u32(palette[index]); });
+		} else {
+			displayBuffer.read(dest, pixels);
+		}
+	}
+
+	// Copies the latest frame, cropped to the viewport as the frontend shows it.
+	auto readVisibleFrame() {
+		std::vector<u32> pixels(std::size_t(getViewportSizes().frame.area()));
+		readFrame(pixels.data(), pixels.size());
+		return pixels;
+	}
+
+	// SHA-1 of a frame's pixels, as reported by every host that hashes frames.
+	static Str hashFrame(const std::vector<u32>& pixels) {
+		return SHA1::from_data(reinterpret_cast<const char*>
+			(pixels.data()), pixels.size() * sizeof(u32));
+	}
+};
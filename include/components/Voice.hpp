@@ -6,11 +6,12 @@
 
 #pragma once
 
+#include <array>
+#include <utility>
 #include <algorithm>
 
-#include "Concepts.hpp"
+#include "Macros.hpp"
 #include "ColorOps.hpp"
-#include "AudioDevice.hpp"
 
 /*==================================================================*/
 
@@ -22,6 +23,28 @@ constexpr inline float transientFall(unsigned iter, float step = 0.01f) noexcept
 
 /*==================================================================*/
 
+/**
+ * @brief Intro/outro gain ramps, precomputed so generators can apply them
+ *        as a block multiply rather than evaluating them per sample.
+ */
+struct TransientRamps {
+	static constexpr unsigned size{ 100 };
+
+	static constexpr auto rise{ []() noexcept {
+		std::array<float, size> ramp{};
+		for (auto i{ 0u }; i < size; ++i) { ramp[i] = ::transientGain(i); }
+		return ramp;
+	}() };
+
+	static constexpr auto fall{ []() noexcept {
+		std::array<float, size> ramp{};
+		for (auto i{ 0u }; i < size; ++i) { ramp[i] = ::transientFall(i); }
+		return ramp;
+	}() };
+};
+
+/*==================================================================*/
+
 struct TransienceGain {
 	bool intro : 1;
 	bool outro : 1;
@@ -36,6 +59,20 @@ struct TransienceGain {
 		return  intro ? ::transientGain(sample_idx) :
 				outro ? ::transientFall(sample_idx) : fallback;
 	}
+
+	// No signal for the entire block, the voice can be skipped.
+	constexpr bool silent() const noexcept { return !intro && !outro && !fallback; }
+
+	// Ramp applied to the start of the block, if any.
+	constexpr const float* ramp() const noexcept {
+		return  intro ? TransientRamps::rise.data() :
+				outro ? TransientRamps::fall.data() : nullptr;
+	}
+
+	// Gain held for the rest of the block after the ramp.
+	constexpr float tail() const noexcept {
+		return  intro ? 1.0f : outro ? 0.0f : float(fallback);
+	}
 };
 
 /*==================================================================*/
@@ -68,74 +105,36 @@ public:
 
 /*==================================================================*/
 
-class Voice {
-	using self = Voice;
-
-protected:
-	double mPhase{}; // [0..1) range.
-	double mStep{};  // [0..1) range.
-	float  mVolumeGain{}; // System-facing volume control, to be controlled by a system.
-	float  mMasterGain{}; // Mastering volume control to manually balance against other voices.
-	
-public:
-	// Pass along additional data to a voice processor, if needed.
-	void* userdata{};
-
-	Voice(float master_gain = 0.2f) noexcept
-		: mVolumeGain{ 1.0f }
-	{ setMasterGain(master_gain); }
-
-	// Get the volume of the voice, in range of: [0..1]
-	constexpr float getVolume()     const noexcept { return mVolumeGain; }
-	// Set the volume of the voice, clamped to: [0..1]
-	constexpr self& setVolume(float gain) noexcept { mVolumeGain = std::clamp(gain, 0.0f, 1.0f); return *this; }
-
-	// Get the mastering volume of the voice, in range of: [0..1]
-	constexpr float getMasterGain()     const noexcept { return mMasterGain; }
-	// Set the mastering volume of the voice, clamped to: [0..1]
-	constexpr self& setMasterGain(float gain) noexcept { mMasterGain = std::clamp(gain, 0.0f, 1.0f); return *this; }
-
-	constexpr Phase getStep()     const noexcept { return mStep; }
-	constexpr self& setStep(Phase step) noexcept { mStep = step; return *this; }
-
-	constexpr Phase getPhase()      const noexcept { return mPhase; }
-	constexpr self& setPhase(Phase phase) noexcept { mPhase = phase; return *this; }
-	
-	// Peek the next raw phase without wrapping it, default is 1 step ahead.
-	constexpr double peekRawPhase(double steps = 1.0) const noexcept
-		{ return mPhase + mStep * steps; }
-
-	// Peek the next phase without modifying it, default is 1 step ahead.
-	constexpr Phase peekPhase(double steps = 1.0) const noexcept
-		{ return peekRawPhase(steps); }
-
-	// Advance the phase by a number of steps, default is 1 step ahead.
-	constexpr self& stepPhase(double steps = 1.0) noexcept
-		{ mPhase = peekPhase(steps); return *this; }
-
-	// Get the current level of the voice sample, optionally with transience gain calculation.
-	constexpr float getLevel(unsigned sample_idx, TransienceGain transience = {}) const noexcept
-		{ return transience.calculate(sample_idx) * getVolume() * getMasterGain(); }
-};
-
-/*==================================================================*/
-
-using Stream = AudioDevice::Stream;
-
-using SampleGenerator = void (*)(float*, unsigned, Voice*, Stream*) noexcept;
-
-struct GeneratorBundle {
-	SampleGenerator functor;
-	Voice* voice;
-
-	GeneratorBundle(SampleGenerator p, Voice* v) noexcept
-		: functor{ p }, voice{ v }
-	{}
-
-	template <IsContiguousContainerOf<float> T>
-	constexpr void run(T& buffer, Stream* stream) const noexcept {
-		functor(std::data(buffer), unsigned(std::size(buffer)), voice, stream);
+/**
+ * @brief Mixes a block of generated samples into the output, scaled by a
+ *        level and the block envelope. Silent blocks are skipped outright,
+ *        and the generator is never invoked past the end of an outro ramp.
+ * @param[in] generate :: Callable returning the raw sample at a block index.
+ */
+template <typename Generator>
+inline void mixVoiceBlock(
+	float* output, unsigned size, float level,
+	TransienceGain transience, Generator&& generate
+) noexcept {
+	if (transience.silent()) { return; }
+
+	const auto* ramp{ transience.ramp() };
+	const auto rampSize{ ramp ? std::min(size, TransientRamps::size) : 0u };
+
+	SUGGEST_VECTORIZABLE_LOOP
+	for (auto i{ 0u }; i < rampSize; ++i)
+		{ output[i] += generate(i) * (ramp[i] * level); }
+
+	if (const auto gain{ transience.tail() * level }) {
+		SUGGEST_VECTORIZABLE_LOOP
+		for (auto i{ rampSize }; i < size; ++i)
+			{ output[i] += generate(i) * gain; }
 	}
-};
-
-using VoiceGenerators = std::initializer_list<GeneratorBundle>;
+}
+
+// Soft-clips a block of samples in place, written to auto-vectorize.
+inline void softClipBlock(float* data, std::size_t size) noexcept {
+	SUGGEST_VECTORIZABLE_LOOP
+	for (std::size_t i{ 0u }; i < size; ++i)
+		{ data[i] = ez::fast_tanh(data[i]); }
+}
@@ -0,0 +1,98 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "Voice.hpp"
+
+/*==================================================================*/
+
+/**
+ * @brief Pool of voices kept as parallel arrays (phases, steps, gains and
+ *        timers each contiguous), sized at construction for any polyphony.
+ *        Active voices are mixed one block at a time, each block loop being
+ *        branch-free so it vectorizes across samples.
+ */
+class VoicePool {
+	using u32 = std::uint32_t;
+
+	std::vector<double>     mPhases;  // [0..1) range
+	std::vector<double>     mSteps;   // [0..1) range
+	std::vector<float>      mVolumes; // system-facing volume
+	std::vector<float>      mMasters; // mastering volume, balances voices
+	std::vector<AudioTimer> mTimers;
+
+public:
+	explicit VoicePool(unsigned count, float master_gain = 0.2f)
+		: mPhases(count), mSteps(count)
+		, mVolumes(count, 1.0f), mMasters(count, std::clamp(master_gain, 0.0f, 1.0f))
+		, mTimers(count)
+	{}
+
+	unsigned size() const noexcept { return unsigned(mTimers.size()); }
+
+	auto& timer(unsigned index)       noexcept { return mTimers[index]; }
+	auto& timer(unsigned index) const noexcept { return mTimers[index]; }
+
+	double getPhase(unsigned index) const noexcept { return mPhases[index]; }
+	void   setPhase(unsigned index, double phase) noexcept { mPhases[index] = phase - long(phase); }
+
+	double getStep(unsigned index) const noexcept { return mSteps[index]; }
+	void   setStep(unsigned index, double step) noexcept { mSteps[index] = step; }
+
+	float getVolume(unsigned index) const noexcept { return mVolumes[index]; }
+	void  setVolume(unsigned index, float gain) noexcept { mVolumes[index] = std::clamp(gain, 0.0f, 1.0f); }
+
+	float getMasterGain(unsigned index) const noexcept { return mMasters[index]; }
+	void  setMasterGain(unsigned index, float gain) noexcept { mMasters[index] = std::clamp(gain, 0.0f, 1.0f); }
+
+	float getLevel(unsigned index) const noexcept { return mVolumes[index] * mMasters[index]; }
+
+	// Advance a voice's phase by a number of samples, wrapping it.
+	void advance(unsigned index, unsigned samples) noexcept
+		{ setPhase(index, mPhases[index] + mSteps[index] * samples); }
+
+	// Whether any voice still has time left on its timer.
+	bool anyActive() const noexcept {
+		return std::any_of(mTimers.begin(), mTimers.end(),
+			[](const AudioTimer& timer) noexcept { return timer.get() != 0; });
+	}
+
+	void tickTimers() noexcept {
+		for (auto& timer : mTimers) { timer.dec(); }
+	}
+
+	/**
+	 * @brief Mixes a block of one voice into the output and advances its phase.
+	 * @param[in] waveAt :: Callable returning the raw sample at a phase in [0..1).
+	 */
+	template <typename Wave>
+	void mixVoice(float* output, unsigned size, unsigned index, Wave&& waveAt) noexcept {
+		const auto phase{ float(mPhases[index]) };
+		const auto step { float(mSteps[index])  };
+
+		::mixVoiceBlock(output, size, getLevel(index), mTimers[index],
+			[=](unsigned i) noexcept {
+				const auto head{ phase + step * float(i) };
+				return waveAt(head - int(head));
+			});
+		advance(index, size);
+	}
+
+	// Mixes the voices at the given indices as 50% duty pulse waves.
+	void mixPulse(float* output, unsigned size, std::span<const u32> voices) noexcept {
+		for (const auto index : voices) {
+			if (index >= this->size()) { continue; }
+			mixVoice(output, size, index, [](float phase) noexcept
+				{ return phase >= 0.5f ? 1.0f : -1.0f; });
+		}
+	}
+};
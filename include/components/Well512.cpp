@@ -17,3 +17,13 @@ Well512::Well512() noexcept {
 		mState[i] = static_cast<result_type>(seed >> i * 2);
 	}
 }
+
+Well512::Well512(unsigned long long seed) noexcept {
+	// splitmix64 spreads any seed, 0 included, over the whole state
+	for (auto i{ 0 }; i < 16; ++i) {
+		auto z{ seed += 0x9E3779B97F4A7C15ull };
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		mState[i] = static_cast<result_type>(z ^ (z >> 31));
+	}
+}
@@ -25,6 +25,7 @@ public:
 	static constexpr result_type max() noexcept { return 0xFFFFFFFF; }
 
 	Well512() noexcept; // automatic seeding based on chrono
+	explicit Well512(unsigned long long seed) noexcept; // reproducible seeding
 
 	template <typename T, std::size_t N>
 		requires (std::is_convertible_v<T, result_type> && N >= 16)
@@ -0,0 +1,116 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <algorithm>
+#include <exception>
+
+#include "WorkStealingPool.hpp"
+#include "BasicLogger.hpp"
+
+/*==================================================================*/
+
+WorkStealingPool::WorkStealingPool(u32 threads) {
+	if (!threads) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+
+	mQueues.reserve(threads);
+	for (auto i{ 0u }; i < threads; ++i)
+		{ mQueues.push_back(std::make_unique<Queue>()); }
+
+	mWorkers.reserve(threads);
+	for (auto i{ 0u }; i < threads; ++i) {
+		mWorkers.emplace_back([this, i](StopToken token) { workerLoop(token, i); });
+	}
+}
+
+WorkStealingPool::~WorkStealingPool() noexcept {
+	for (auto& worker : mWorkers) { worker.request_stop(); }
+	{ std::lock_guard lock{ mIdleLock }; }
+	mIdleSignal.notify_all();
+	mWorkers.clear();
+}
+
+/*==================================================================*/
+
+void WorkStealingPool::submit(Task task) {
+	const auto index{ tOwner == this ? tIndex
+		: mNextQueue.fetch_add(1, mo::relaxed) % size() };
+
+	mPending.fetch_add(1, mo::relaxed);
+	{
+		std::lock_guard lock{ mQueues[index]->lock };
+		mQueues[index]->tasks.push_back(std::move(task));
+	}
+	mQueued.fetch_add(1, mo::release);
+
+	// taking the lock orders the push before an idle worker's recheck
+	{ std::lock_guard lock{ mIdleLock }; }
+	mIdleSignal.notify_one();
+}
+
+void WorkStealingPool::wait() {
+	std::unique_lock lock{ mIdleLock };
+	mDoneSignal.wait(lock, [this]() noexcept
+		{ return mPending.load(mo::acquire) == 0; });
+}
+
+/*==================================================================*/
+
+bool WorkStealingPool::popLocal(u32 index, Task& task) {
+	auto& queue{ *mQueues[index] };
+	std::lock_guard lock{ queue.lock };
+	if (queue.tasks.empty()) { return false; }
+
+	task = std::move(queue.tasks.back());
+	queue.tasks.pop_back();
+	return true;
+}
+
+bool WorkStealingPool::stealFor(u32 index, Task& task) {
+	// start past our own deque so thieves don't all pile onto the same victim
+	for (auto offset{ 1u }; offset < size(); ++offset) {
+		auto& queue{ *mQueues[(index + offset) % size()] };
+		std::lock_guard lock{ queue.lock };
+		if (queue.tasks.empty()) { continue; }
+
+		task = std::move(queue.tasks.front());
+		queue.tasks.pop_front();
+		mSteals.fetch_add(1, mo::relaxed);
+		return true;
+	}
+	return false;
+}
+
+void WorkStealingPool::finishTask() noexcept {
+	if (mPending.fetch_sub(1, mo::acq_rel) == 1) {
+		{ std::lock_guard lock{ mIdleLock }; }
+		mDoneSignal.notify_all();
+	}
+}
+
+void WorkStealingPool::workerLoop(StopToken token, u32 index) {
+	tOwner = this;
+	tIndex = index;
+
+	Task task;
+	while (!token.stop_requested()) [[likely]] {
+		if (popLocal(index, task) || stealFor(index, task)) {
+			mQueued.fetch_sub(1, mo::relaxed);
+			try { task(); }
+			catch (const std::exception& e) {
+				blog.newEntry(BLOG::ERROR,
+					"Exception escaped a pooled task! [{}]", e.what());
+			}
+			task = nullptr;
+			finishTask();
+			continue;
+		}
+
+		std::unique_lock lock{ mIdleLock };
+		mIdleSignal.wait(lock, [&]() noexcept {
+			return token.stop_requested() || mQueued.load(mo::acquire) > 0;
+		});
+	}
+}
@@ -0,0 +1,84 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include "Typedefs.hpp"
+#include "HDIS_HCIS.hpp"
+#include "AtomSharedPtr.hpp"
+#include "Thread.hpp"
+
+/*==================================================================*/
+
+/**
+ * @brief Fixed-size thread pool where every worker owns a task deque.
+ *
+ * @details
+ * Workers pop from the back of their own deque and, once it runs dry, steal
+ * from the front of the others, so uneven jobs spread out by themselves.
+ * Tasks submitted from outside are dealt round-robin, tasks submitted from
+ * inside a task go to the submitting worker's own deque.
+ */
+class WorkStealingPool final {
+public:
+	using Task = std::function<void()>;
+
+private:
+	struct alignas(HDIS) Queue {
+		std::mutex lock;
+		std::deque<Task> tasks;
+	};
+
+	std::vector<std::unique_ptr<Queue>> mQueues;
+	std::vector<Thread> mWorkers;
+
+	// Idle workers sleep on these until a task is queued or a stop is requested.
+	std::mutex mIdleLock;
+	std::condition_variable mIdleSignal;
+	std::condition_variable mDoneSignal;
+
+	Atom<u32> mQueued{};  // tasks sitting in a deque
+	Atom<u32> mPending{}; // tasks submitted but not yet finished
+	Atom<u32> mNextQueue{};
+	Atom<u64> mSteals{};
+
+	static inline thread_local const WorkStealingPool* tOwner{};
+	static inline thread_local u32 tIndex{};
+
+	bool popLocal(u32 index, Task& task);
+	bool stealFor(u32 index, Task& task);
+	void finishTask() noexcept;
+
+	void workerLoop(StopToken token, u32 index);
+
+public:
+	/**
+	 * @brief Starts the worker threads.
+	 * @param[in] threads :: Worker count, 0 to match the hardware concurrency.
+	 */
+	explicit WorkStealingPool(u32 threads = 0);
+
+	// Stops the workers, dropping tasks that have not started yet.
+	~WorkStealingPool() noexcept;
+
+	WorkStealingPool(const WorkStealingPool&) = delete;
+	WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+	void submit(Task task);
+
+	// Blocks until every submitted task has finished.
+	void wait();
+
+	auto size()      const noexcept { return u32(mQueues.size()); }
+	auto getSteals() const noexcept { return mSteals.load(mo::relaxed); }
+};
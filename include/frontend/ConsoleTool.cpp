@@ -0,0 +1,47 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <new>
+
+#include "HomeDirManager.hpp"
+#include "GlobalAudioBase.hpp"
+#include "HDIS_HCIS.hpp"
+
+#include "ConsoleTool.hpp"
+#include "FrontendHost.hpp"
+#include "SystemInterface.hpp"
+#include "CoreRegistry.hpp"
+
+/*==================================================================*/
+
+void ConsoleTool::DestroyCore::operator()(SystemInterface* ptr) noexcept {
+	if (ptr) {
+		ptr->~SystemInterface();
+		::operator delete(ptr, std::align_val_t(HDIS));
+	}
+}
+
+void ConsoleTool::addConfigOptions(cxxopts::Options& options) {
+	options.add_options("Configuration")
+		("homedir",  "Forces application to use a different home directory to read/write files.",
+			cxxopts::value<Str>())
+		("portable", "Force application to operate in portable mode, setting the home directory to the executable's location. Overriden by --home.",
+			cxxopts::value<bool>()->default_value("false"));
+}
+
+bool ConsoleTool::initialize(const cxxopts::ParseResult& result) noexcept {
+	HDM = HomeDirManager::initialize(
+		result.count("homedir") ? result["homedir"].as<Str>() : ""s,
+		""s, result.count("portable") ? true : false, OrgName, AppName);
+	if (!HDM) { return false; }
+
+	HDM->setValidator(CoreRegistry::validateProgram);
+	SystemInterface::assignComponents(HDM);
+	CoreRegistry::loadProgramDB();
+	GlobalAudioBase::disableOutput();
+
+	return true;
+}
@@ -0,0 +1,42 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <memory>
+
+#include "Typedefs.hpp"
+
+#include <cxxopts.hpp>
+
+/*==================================================================*/
+
+class HomeDirManager;
+class SystemInterface;
+
+/**
+ * @brief Startup shared by the console tools, which construct cores themselves and
+ *        run them on their own threads, without any host, window or audio output.
+ */
+class ConsoleTool {
+public:
+	struct DestroyCore {
+		void operator()(SystemInterface* ptr) noexcept;
+	};
+	using SystemCore = std::unique_ptr
+		<SystemInterface, DestroyCore>;
+
+	static inline HomeDirManager* HDM{};
+
+	// Adds the home directory options, under the "Configuration" group.
+	static void addConfigOptions(cxxopts::Options& options);
+
+	/**
+	 * @brief Sets up the file manager from the parsed options, along with the program
+	 *        database, and disables audio output. Returns false if either fails.
+	 */
+	static bool initialize(const cxxopts::ParseResult& result) noexcept;
+};
@@ -11,6 +11,7 @@
 #include <cxxopts.hpp>
 
 #include "FrontendHost.hpp"
+#include "HeadlessHost.hpp"
 
 #ifdef _WIN32
 	#pragma warning(push)
@@ -30,6 +31,8 @@
 
 BasicLogger& blog{ *BasicLogger::initialize() };
 
+static bool sHeadless{};
+
 /*==================================================================*/
 
 SDL_AppResult SDL_AppInit(void **Host, int argc, char *argv[]) {
@@ -55,6 +58,22 @@ SDL_AppResult SDL_AppInit(void **Host, int argc, char *argv[]) {
 		("headless", "Forces the application to run without a graphical user interface.",
 			cxxopts::value<bool>()->default_value("false"));
 
+	options.add_options("Headless")
+		("frames",      "Number of frames to run before exiting, 0 to run until the program halts.",
+			cxxopts::value<u64>()->default_value("0"))
+		("dump-frames", "Directory to write every presented frame to, as PPM images.",
+			cxxopts::value<Str>())
+		("hash-frames", "Print the SHA-1 hash of every presented frame.",
+			cxxopts::value<bool>()->default_value("false"))
+		("seed",        "Seed for the core's random number generator, so that runs are reproducible.",
+			cxxopts::value<u64>()->default_value("0"))
+		("audio",       "Open the audio device, which headless mode leaves closed otherwise.",
+			cxxopts::value<bool>()->default_value("false"))
+		("unlimited",   "Run frames back to back instead of at the system's framerate. The frames produced are unchanged.",
+			cxxopts::value<bool>()->default_value("false"))
+		("benchmark",   "Let cores raise their cycles per frame to fill the frame time, as the F10 benchmark mode. Changes the frames produced.",
+			cxxopts::value<bool>()->default_value("false"));
+
 	options.add_options("Configuration")
 		("homedir",  "Forces application to use a different home directory to read/write files.",
 			cxxopts::value<Str>())
@@ -82,11 +101,38 @@ SDL_AppResult SDL_AppInit(void **Host, int argc, char *argv[]) {
 
 	if (result.count("help")) {
 		Console::Attach();
-		fmt::println("{}", options.help({ "Runtime", "Configuration", "General" }));
+		fmt::println("{}", options.help({ "Runtime", "Headless", "Configuration", "General" }));
 
 		return SDL_APP_SUCCESS;
 	}
 
+	if (result["headless"].as<bool>()) {
+		Console::Attach();
+		sHeadless = true;
+
+		// the core paces itself on its own thread, the main thread only polls its state
+		SDL_SetHint(SDL_HINT_MAIN_CALLBACK_RATE, "100");
+
+		if (!HeadlessHost::initApplication(
+			result.count("homedir")  ? result["homedir"].as<Str>() : ""s,
+			result.count("config")   ? result["config"] .as<Str>() : ""s,
+			result.count("portable") ? true : false,
+			result["audio"].as<bool>()
+		)) { return SDL_APP_FAILURE; }
+
+		*Host = HeadlessHost::initialize({
+			.program    = result.count("program") ? result["program"].as<Str>() : ""s,
+			.dumpDir    = result.count("dump-frames") ? result["dump-frames"].as<Str>() : ""s,
+			.frames     = result["frames"].as<u64>(),
+			.seed       = result["seed"].as<u64>(),
+			.hashFrames = result["hash-frames"].as<bool>(),
+			.unlimited  = result["unlimited"].as<bool>(),
+			.benchmark  = result["benchmark"].as<bool>(),
+		});
+
+		return *Host ? SDL_APP_CONTINUE : SDL_APP_FAILURE;
+	}
+
 	if (!FrontendHost::initApplication(
 		result.count("homedir")  ? result["homedir"].as<Str>() : ""s,
 		result.count("config")   ? result["config"] .as<Str>() : ""s,
@@ -103,6 +149,11 @@ SDL_AppResult SDL_AppInit(void **Host, int argc, char *argv[]) {
 /*==================================================================*/
 
 SDL_AppResult SDL_AppIterate(void *pHost) {
+	if (sHeadless) {
+		return static_cast<SDL_AppResult>(
+			static_cast<HeadlessHost*>(pHost)->processFrame());
+	}
+
 	auto* Host{ static_cast<FrontendHost*>(pHost) };
 
 	Host->processFrame();
@@ -113,6 +164,11 @@ SDL_AppResult SDL_AppIterate(void *pHost) {
 /*==================================================================*/
 
 SDL_AppResult SDL_AppEvent(void *pHost, SDL_Event *event) {
+	if (sHeadless) {
+		return static_cast<SDL_AppResult>(
+			static_cast<HeadlessHost*>(pHost)->processEvents(event));
+	}
+
 	auto* Host{ static_cast<FrontendHost*>(pHost) };
 
 	return static_cast<SDL_AppResult>(Host->processEvents(event));
@@ -121,7 +177,9 @@ SDL_AppResult SDL_AppEvent(void *pHost, SDL_Event *event) {
 /*==================================================================*/
 
 void SDL_AppQuit(void *pHost, SDL_AppResult) {
-	if (pHost) {
+	if (pHost && sHeadless) {
+		static_cast<HeadlessHost*>(pHost)->quitApplication();
+	} else if (pHost) {
 		auto* Host{ static_cast<FrontendHost*>(pHost) };
 		Host->quitApplication();
 	}
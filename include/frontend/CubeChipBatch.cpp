@@ -0,0 +1,187 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <algorithm>
+#include <vector>
+#include <fstream>
+
+#include "BasicLogger.hpp"
+#include "AttachConsole.hpp"
+#include "HomeDirManager.hpp"
+#include "WorkStealingPool.hpp"
+
+#include "ConsoleTool.hpp"
+#include "FrontendHost.hpp"
+#include "SystemInterface.hpp"
+#include "CoreRegistry.hpp"
+
+/*==================================================================*/
+
+BasicLogger& blog{ *BasicLogger::initialize() };
+
+/*==================================================================*/
+
+struct BatchResult {
+	Str core{};
+	Str frameHash{};
+	u64 frames{};  // may fall short of the requested count if the core halted
+	u64 cycles{};
+	f64 wallMs{};
+	bool loaded{};
+};
+
+// File loading and core construction go through shared registries.
+static std::mutex sConstructLock;
+
+static auto readProgramList(const Path& listFile) {
+	std::vector<Path> programs;
+	std::ifstream input{ listFile };
+
+	for (Str line; std::getline(input, line);) {
+		if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+		if (line.empty() || line.front() == '#') { continue; }
+		programs.emplace_back(line);
+	}
+	return programs;
+}
+
+static BatchResult runBatchJob(const Path& program, u64 frames) {
+	ConsoleTool::SystemCore core;
+
+	BatchResult result;
+	{
+		std::lock_guard lock{ sConstructLock };
+		if (!ConsoleTool::HDM->validateGameFile(program)) { return result; }
+		core.reset(CoreRegistry::constructCore());
+		if (!core) { return result; }
+		result.core = CoreRegistry::getCurrentCore().coreName;
+	}
+	result.loaded = true;
+
+	const auto start{ std::chrono::steady_clock::now() };
+	core->runFrames(frames);
+	result.wallMs = std::chrono::duration<f64, std::milli>
+		(std::chrono::steady_clock::now() - start).count();
+	result.cycles = core->getElapsedCycles();
+
+	result.frames    = core->getFrameCount();
+	result.frameHash = VideoSink::hashFrame(core->getVideoSink().readVisibleFrame());
+
+	return result;
+}
+
+static auto runBatch(const std::vector<Path>& programs, u64 frames, u32 threads) {
+	std::vector<BatchResult> results(programs.size());
+
+	WorkStealingPool pool{ threads };
+	blog.newEntry(BLOG::INFO, "Running {} programs for {} frames on {} threads",
+		programs.size(), frames, pool.size());
+
+	for (auto i{ 0u }; i < programs.size(); ++i) {
+		pool.submit([&, i]() { results[i] = runBatchJob(programs[i], frames); });
+	}
+	pool.wait();
+	blog.newEntry(BLOG::INFO, "Workers stole {} jobs", pool.getSteals());
+
+	return results;
+}
+
+/*==================================================================*/
+
+int main(int argc, char* argv[]) {
+	static_assert(std::endian::native == std::endian::little,
+		"Only little-endian systems are supported!");
+
+	Console::Attach();
+
+	cxxopts::Options options(AppName, "Runs programs unpaced and headless, in parallel, for throughput testing");
+
+	options.add_options("Batch")
+		("list",    "Text file listing one program path per line, lines starting with # are skipped.",
+			cxxopts::value<Str>())
+		("frames",  "Number of frames to run each program for.",
+			cxxopts::value<u64>()->default_value("600"))
+		("threads", "Number of worker threads, 0 to use every hardware thread.",
+			cxxopts::value<u32>()->default_value("0"))
+		("output",  "CSV file to write the per-program results to.",
+			cxxopts::value<Str>()->default_value("batch_results.csv"))
+		("seed",    "Seed for every core's random number generator, so that frame hashes are reproducible.",
+			cxxopts::value<u64>()->default_value("0"))
+		("verify",  "Run the list a second time on a different number of threads, failing if any frame hash differs.",
+			cxxopts::value<bool>()->default_value("false"));
+
+	ConsoleTool::addConfigOptions(options);
+
+	options.add_options("General")
+		("help", "List application options.");
+
+	options.parse_positional({ "list" });
+	options.positional_help("program_list");
+
+	auto result{ options.parse(argc, argv) };
+
+	if (result.count("help") || !result.count("list")) {
+		fmt::println("{}", options.help({ "Batch", "Configuration", "General" }));
+		return result.count("help") ? 0 : 1;
+	}
+
+	if (!ConsoleTool::initialize(result)) { return 1; }
+	SystemInterface::setRandomSeed(result["seed"].as<u64>());
+
+	const auto programs{ readProgramList(result["list"].as<Str>()) };
+	const auto frames  { std::max<u64>(result["frames"].as<u64>(), 1) };
+	if (programs.empty()) {
+		blog.newEntry(BLOG::ERROR, "No programs listed in: \"{}\"", result["list"].as<Str>());
+		return 1;
+	}
+
+	const auto threads{ result["threads"].as<u32>() };
+
+	const auto start{ std::chrono::steady_clock::now() };
+	const auto results{ runBatch(programs, frames, threads) };
+	const auto totalMs{ std::chrono::duration<f64, std::milli>
+		(std::chrono::steady_clock::now() - start).count() };
+
+	// a core must not carry any state over between jobs sharing a worker thread,
+	// so a rerun on another thread count, thus another schedule, must match
+	auto mismatched{ 0u };
+	if (result["verify"].as<bool>()) {
+		const auto rerun{ runBatch(programs, frames, threads == 1 ? 0 : 1) };
+		for (auto i{ 0u }; i < programs.size(); ++i) {
+			if (results[i].frameHash == rerun[i].frameHash) { continue; }
+			blog.newEntry(BLOG::ERROR, "Frame hash differs between runs: \"{}\"", programs[i].string());
+			++mismatched;
+		}
+	}
+
+	std::ofstream output{ result["output"].as<Str>() };
+	if (!output) {
+		blog.newEntry(BLOG::ERROR, "Failed to open output file: \"{}\"", result["output"].as<Str>());
+		return 1;
+	}
+
+	output << "program,core,frames,cycles,wall_ms,frame_sha1\n";
+	auto failed{ 0u };
+	auto framesRun{ 0ull };
+	for (auto i{ 0u }; i < programs.size(); ++i) {
+		const auto& job{ results[i] };
+		if (!job.loaded) { ++failed; }
+		framesRun += job.frames;
+		output << fmt::format("\"{}\",{},{},{},{:.3f},{}\n", programs[i].string(),
+			job.loaded ? job.core : "FAILED", job.frames,
+			job.cycles, job.wallMs, job.frameHash);
+	}
+
+	fmt::println("{} programs ({} failed) in {:.1f} ms, {:.1f} frames/s",
+		programs.size(), failed, totalMs, framesRun * 1000.0 / std::max(totalMs, 1.0));
+
+	if (mismatched) { fmt::println("{} programs gave different frame hashes across runs", mismatched); }
+
+	return mismatched ? 3 : failed ? 2 : 0;
+}
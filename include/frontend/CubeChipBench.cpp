@@ -0,0 +1,173 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <chrono>
+#include <memory>
+#include <algorithm>
+#include <vector>
+#include <cctype>
+#include <fstream>
+
+#include "BasicLogger.hpp"
+#include "AttachConsole.hpp"
+#include "HomeDirManager.hpp"
+
+#include "ConsoleTool.hpp"
+#include "FrontendHost.hpp"
+#include "SystemInterface.hpp"
+#include "CoreRegistry.hpp"
+#include "BYTEPUSHER/Cores/BYTEPUSHER_STANDARD.hpp"
+
+/*==================================================================*/
+
+BasicLogger& blog{ *BasicLogger::initialize() };
+
+/*==================================================================*/
+
+/**
+ * @brief The plain BytePusher frame loop, fetching every 24-bit address with three
+ *        dependent byte loads, as the baseline the core's loop is measured against.
+ */
+class ReferenceLoop final {
+	std::vector<u8> mMemory;
+
+	u32 readData(u32 pos) const noexcept {
+		return mMemory[pos + 0] << 16
+			 | mMemory[pos + 1] <<  8
+			 | mMemory[pos + 2];
+	}
+
+public:
+	// memory is padded so that a jump read at the last address stays in bounds
+	explicit ReferenceLoop(const Path& program)
+		: mMemory(MiB(16) + 8)
+	{
+		std::ifstream file{ program, std::ios::binary };
+		file.read(reinterpret_cast<char*>(mMemory.data()), MiB(16));
+	}
+
+	void runFrame() noexcept {
+		mMemory[0] = mMemory[1] = 0; // no keys held
+
+		auto progPointer{ readData(2) };
+		for (auto cycle{ 0u }; cycle < 0x10000; ++cycle) {
+			mMemory[readData(progPointer + 3)] = mMemory[readData(progPointer + 0)];
+			progPointer = readData(progPointer + 6);
+		}
+	}
+};
+
+// Times only the run step, setup builds a fresh instance each time, untimed.
+template <typename Setup, typename Run>
+static f64 timeBestOf(u32 repeats, Setup&& setup, Run&& run) {
+	auto best{ 0.0 };
+	for (auto i{ 0u }; i < repeats; ++i) {
+		auto subject{ setup() };
+		if (!subject) { return 0.0; }
+
+		const auto start{ std::chrono::steady_clock::now() };
+		run(*subject);
+		const auto elapsed{ std::chrono::duration<f64, std::milli>
+			(std::chrono::steady_clock::now() - start).count() };
+		best = i ? std::min(best, elapsed) : elapsed;
+	}
+	return best;
+}
+
+static bool isBytePusherFile(const Path& program) {
+	auto extension{ program.extension().string() };
+	std::transform(extension.begin(), extension.end(), extension.begin(),
+		[](unsigned char c) { return char(std::tolower(c)); });
+	return extension == ".bytepusher";
+}
+
+/*==================================================================*/
+
+int main(int argc, char* argv[]) {
+	static_assert(std::endian::native == std::endian::little,
+		"Only little-endian systems are supported!");
+
+	Console::Attach();
+
+	cxxopts::Options options(AppName, "Times the BytePusher core's frame loop against a plain reference loop");
+
+	options.add_options("Bench")
+		("programs", "BytePusher programs to run.",
+			cxxopts::value<std::vector<Str>>())
+		("frames",   "Number of frames to run each program for.",
+			cxxopts::value<u64>()->default_value("600"))
+		("repeat",   "Number of timed runs per program, the fastest is reported.",
+			cxxopts::value<u32>()->default_value("3"));
+
+	ConsoleTool::addConfigOptions(options);
+
+	options.add_options("General")
+		("help", "List application options.");
+
+	options.parse_positional({ "programs" });
+	options.positional_help("program...");
+
+	auto result{ options.parse(argc, argv) };
+
+	if (result.count("help") || !result.count("programs")) {
+		fmt::println("{}", options.help({ "Bench", "Configuration", "General" }));
+		return result.count("help") ? 0 : 1;
+	}
+
+	if (!ConsoleTool::initialize(result)) { return 1; }
+
+	const auto frames { std::max<u64>(result["frames"].as<u64>(), 1) };
+	const auto repeats{ std::max<u32>(result["repeat"].as<u32>(), 1) };
+
+	// single-step runs every instruction through the fetch path alone, the core
+	// column adds the copy run coalescing on top
+	fmt::println("{:<40} {:>14} {:>14} {:>8} {:>14} {:>8}", "program",
+		"reference ms/f", "single ms/f", "speedup", "core ms/f", "speedup");
+
+	const auto timeCore{ [&](bool coalesce) {
+		return timeBestOf(repeats,
+			[coalesce]() {
+				ConsoleTool::SystemCore core{ CoreRegistry::constructCore() };
+				if (auto* bytepusher{ dynamic_cast<BYTEPUSHER_STANDARD*>(core.get()) })
+					{ bytepusher->setRunCoalescing(coalesce); }
+				else { core.reset(); }
+				return core;
+			},
+			[&](SystemInterface& core) { core.runFrames(frames); }
+		) / f64(frames);
+	} };
+
+	auto failed{ 0u };
+	for (const auto& name : result["programs"].as<std::vector<Str>>()) {
+		const Path program{ name };
+
+		if (!isBytePusherFile(program) || !ConsoleTool::HDM->validateGameFile(program)) {
+			blog.newEntry(BLOG::ERROR, "Not a BytePusher program: \"{}\"", name);
+			++failed; continue;
+		}
+
+		const auto singleMs{ timeCore(false) };
+		const auto coreMs  { timeCore(true)  };
+		if (singleMs <= 0.0 || coreMs <= 0.0) {
+			blog.newEntry(BLOG::ERROR, "Failed to construct core for: \"{}\"", name);
+			++failed; continue;
+		}
+
+		const auto referenceMs{ timeBestOf(repeats,
+			[&]() { return std::make_unique<ReferenceLoop>(program); },
+			[&](ReferenceLoop& reference) {
+				for (auto frame{ 0ull }; frame < frames; ++frame) { reference.runFrame(); }
+			}
+		) / f64(frames) };
+
+		fmt::println("{:<40} {:>14.4f} {:>14.4f} {:>7.2f}x {:>14.4f} {:>7.2f}x",
+			program.filename().string(), referenceMs,
+			singleMs, referenceMs / std::max(singleMs, 1e-9),
+			coreMs,   referenceMs / std::max(coreMs,   1e-9));
+	}
+
+	return failed ? 2 : 0;
+}
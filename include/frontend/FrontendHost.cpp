@@ -4,6 +4,8 @@
 	file, You can obtain one at http://mozilla.org/MPL/2.0/.
 */
 
+#include <utility>
+
 #include <SDL3/SDL_init.h>
 #include <SDL3/SDL_events.h>
 #include <SDL3/SDL_dialog.h>
@@ -21,17 +23,22 @@
 #include "FrontendHost.hpp"
 #include "fonts/RobotoMono.hpp"
 #include "SystemInterface.hpp"
+#include "ThreadPolicy.hpp"
+#include "CycleController.hpp"
 #include "CoreRegistry.hpp"
+#include "VideoSink.hpp"
 
 /*==================================================================*/
 
 FrontendHost::FrontendHost(const Path& gamePath) noexcept {
-	SystemInterface::assignComponents(HDM, BVS);
+	SystemInterface::assignComponents(HDM);
 	HDM->setValidator(CoreRegistry::validateProgram);
 	CoreRegistry::loadProgramDB();
 
 	FrontendInterface::FnHook_OpenFile
 		.store(openFileDialog, mo::relaxed);
+	FrontendInterface::FnHook_OpenInstance
+		.store(openInstanceDialog, mo::relaxed);
 
 	if (!gamePath.empty()) { loadGameFile(gamePath); }
 	if (!mSystemCore) { BVS->setMainWindowTitle(AppName, "Waiting for file..."); }
@@ -45,10 +52,27 @@ void FrontendHost::StopSystemThread::operator()(SystemInterface* ptr) noexcept {
 	}
 }
 
+FrontendHost::Settings FrontendHost::sSettings{};
+
+SettingsMap FrontendHost::Settings::map() noexcept {
+	return {
+		makeSetting("Frontend.MaxInstances", &max_instances),
+	};
+}
+
+SystemInterface* FrontendHost::getFocusedCore(const VideoSink* focused) noexcept {
+	for (auto& core : mInstances) {
+		if (&core->getVideoSink() == focused) { return core.get(); }
+	}
+	return mSystemCore.get();
+}
+
 /*==================================================================*/
 
 void FrontendHost::discardCore() {
+	mInstances.clear();
 	mSystemCore.reset();
+	mSystemFile.clear();
 	
 	BVS->setMainWindowTitle(AppName, "Waiting for file...");
 	BVS->resetMainWindow();
@@ -63,51 +87,77 @@ void FrontendHost::replaceCore() {
 	mSystemCore.reset(CoreRegistry::constructCore());
 	if (mSystemCore) {
 		BVS->setMainWindowTitle(AppName, HDM->getFileStem());
-		BVS->displayBuffer.resize(mSystemCore->getDisplaySize());
+		mSystemFile = HDM->getFilePath();
 		toggleSystemLimiter();
 		mSystemCore->startWorker();
 	}
 }
 
+void FrontendHost::reloadCore() {
+	// the file cache may hold a program opened for another instance since
+	if (HDM->getFilePath() != mSystemFile.string()
+		&& !HDM->validateGameFile(mSystemFile)) { return; }
+	replaceCore();
+}
+
+void FrontendHost::spawnInstance() {
+	if (sSettings.max_instances && mInstances.size() >= sSettings.max_instances) {
+		blog.newEntry(BLOG::WARN, "Instance limit of {} reached!", sSettings.max_instances);
+		return;
+	}
+
+	SystemCore instance{ CoreRegistry::constructCore() };
+	if (!instance) { return; }
+
+	if (mUnlimited) { instance->addSystemState(EmuState::BENCH); }
+	instance->startWorker();
+	mInstances.push_back(std::move(instance));
+}
+
 /*==================================================================*/
 
-void FrontendHost::loadGameFile(const Path& gameFile) {
+void FrontendHost::loadGameFile(const Path& gameFile, bool asInstance) {
 	BVS->raiseMainWindow();
 	blog.newEntry(BLOG::INFO, "Attempting to load: \"{}\"", gameFile.string());
 	if (HDM->validateGameFile(gameFile)) {
 		blog.newEntry(BLOG::INFO, "File has been accepted!");
-		replaceCore();
+		if (asInstance && mSystemCore) { spawnInstance(); }
+		else { replaceCore(); }
 	} else {
 		blog.newEntry(BLOG::INFO, "Path has been rejected!");
 	}
 }
 
 void FrontendHost::hideMainWindow(bool state) noexcept {
-	if (!mSystemCore) { return; }
-
-	if (state) {
-		mSystemCore->addSystemState(EmuState::HIDDEN);
-	} else {
-		mSystemCore->subSystemState(EmuState::HIDDEN);
-	}
+	forEachCore([state](SystemInterface& core) noexcept {
+		if (state) {
+			core.addSystemState(EmuState::HIDDEN);
+		} else {
+			core.subSystemState(EmuState::HIDDEN);
+		}
+	});
 }
 
 void FrontendHost::pauseSystem(bool state) noexcept {
-	if (!mSystemCore) { return; }
-
-	if (state) {
-		mSystemCore->addSystemState(EmuState::PAUSED);
-	} else {
-		mSystemCore->subSystemState(EmuState::PAUSED);
-	}
+	forEachCore([state](SystemInterface& core) noexcept {
+		if (state) {
+			core.addSystemState(EmuState::PAUSED);
+		} else {
+			core.subSystemState(EmuState::PAUSED);
+		}
+	});
 }
 
 void FrontendHost::quitApplication() noexcept {
+	mInstances.clear();
 	mSystemCore.reset();
 
 	HDM->writeMainAppConfig(
+		sSettings.map(),
 		GAB->exportSettings().map(),
-		BVS->exportSettings().map()
+		BVS->exportSettings().map(),
+		ThreadPolicy::exportSettings().map(),
+		CycleController::exportSettings().map()
 	);
 }
 
@@ -118,12 +168,20 @@ bool FrontendHost::initApplication(StrV overrideHome, StrV configName, bool forc
 
 	GlobalAudioBase::Settings GAB_settings;
 	BasicVideoSpec::Settings BVS_settings;
+	ThreadPolicy::Settings TP_settings;
+	CycleController::Settings CC_settings;
 
 	HDM->parseMainAppConfig(
+		sSettings.map(),
 		GAB_settings.map(),
-		BVS_settings.map()
+		BVS_settings.map(),
+		TP_settings.map(),
+		CC_settings.map()
 	);
 
+	ThreadPolicy::configure(TP_settings);
+	CycleController::configure(CC_settings);
+
 	GAB = GlobalAudioBase::initialize(GAB_settings);
 	if (GAB->getStatus() == GlobalAudioBase::STATUS::NO_AUDIO)
 		{ blog.newEntry(BLOG::WARN, "Audio Subsystem is not available!"); }
@@ -148,6 +206,16 @@ s32  FrontendHost::processEvents(void* event) noexcept {
 				loadGameFile(sdl_event->drop.data);
 				break;
 
+			case SDL_EVENT_KEY_DOWN:
+			case SDL_EVENT_KEY_UP:
+				if (sdl_event->key.repeat) { break; }
+				// only the focused view's core plays, so instances are driven one at a time
+				if (auto* core{ getFocusedCore(BVS->getFocusedInstance()) }) {
+					core->pushKeyEvent(sdl_event->key.scancode,
+						sdl_event->key.down, sdl_event->key.timestamp);
+				}
+				break;
+
 			case SDL_EVENT_WINDOW_MINIMIZED:
 				hideMainWindow(true);
 				break;
@@ -174,16 +242,29 @@ void FrontendHost::processFrame() {
 	checkForHotkeys();
 
 	const auto dialogResult{ HDM->getProbableFile() };
-	if (dialogResult) { loadGameFile(*dialogResult); }
+	if (dialogResult) { loadGameFile(*dialogResult, std::exchange(sAsInstance, false)); }
 
 	if (!BVS->isSuccessful())
 		[[unlikely]] { return; }
 
-	BVS->renderPresent(!!mSystemCore, mSystemCore && mShowOverlay
+	std::vector<VideoSink*> instanceSinks;
+	instanceSinks.reserve(mInstances.size());
+	for (auto& core : mInstances)
+		{ instanceSinks.push_back(&core->getVideoSink()); }
+
+	BVS->renderPresent(mSystemCore ? &mSystemCore->getVideoSink() : nullptr,
+		instanceSinks, mSystemCore && mShowOverlay
 		? mSystemCore->copyOverlayData().c_str() : nullptr);
 }
 
 void FrontendHost::openFileDialog() noexcept {
+	sAsInstance = false;
+	SDL_ShowOpenFileDialog(HomeDirManager::probableFileCallback,
+		nullptr, BVS->getMainWindow(), nullptr, 0, nullptr, false);
+}
+
+void FrontendHost::openInstanceDialog() noexcept {
+	sAsInstance = true;
 	SDL_ShowOpenFileDialog(HomeDirManager::probableFileCallback,
 		nullptr, BVS->getMainWindow(), nullptr, 0, nullptr, false);
 }
@@ -213,22 +294,28 @@ void FrontendHost::checkForHotkeys() {
 		if (Input.isPressed(KEY(ESCAPE)))
 			{ discardCore(); return; }
 		if (Input.isPressed(KEY(BACKSPACE)))
-			{ replaceCore(); return; }
+			{ reloadCore(); return; }
 
 		if (Input.isPressed(KEY(F11)))
 			{ mShowOverlay = !mShowOverlay; }
 		if (Input.isPressed(KEY(F10)))
 			{ mUnlimited = !mUnlimited; toggleSystemLimiter(); }
+
+		if (Input.isPressed(KEY(TAB)))
+			{ forEachCore([](SystemInterface& core) noexcept { core.setTurboFrames(cTurboFrames); }); }
+		if (Input.isReleased(KEY(TAB)))
+			{ forEachCore([](SystemInterface& core) noexcept { core.setTurboFrames(1); }); }
 	}
 }
 
 void FrontendHost::toggleSystemLimiter() noexcept {
-	if (!mSystemCore) { return; }
-	if (mUnlimited) {
-		mSystemCore->addSystemState(EmuState::BENCH);
-	} else {
-		mSystemCore->subSystemState(EmuState::BENCH);
-	}
+	forEachCore([this](SystemInterface& core) noexcept {
+		if (mUnlimited) {
+			core.addSystemState(EmuState::BENCH);
+		} else {
+			core.subSystemState(EmuState::BENCH);
+		}
+	});
 }
 
 /*VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV*/
@@ -7,8 +7,10 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "Typedefs.hpp"
+#include "SettingWrapper.hpp"
 
 /*==================================================================*/
 
@@ -44,10 +46,21 @@ class HomeDirManager;
 class GlobalAudioBase;
 class BasicVideoSpec;
 class SystemInterface;
+class VideoSink;
 
 /*==================================================================*/
 
 class FrontendHost final {
+public:
+	struct Settings {
+		u32 max_instances{ 16 }; // extra cores allowed beside the main one, 0 for no limit
+
+		SettingsMap map() noexcept;
+	};
+
+private:
+	static Settings sSettings;
+
 	FrontendHost(const Path&) noexcept;
 
 	FrontendHost(const FrontendHost&) = delete;
@@ -60,14 +73,31 @@ class FrontendHost final {
 		<SystemInterface, StopSystemThread>;
 
 	SystemCore mSystemCore;
+	std::vector<SystemCore> mInstances;
+	Path mSystemFile;
+
+	static inline bool sAsInstance{};
 
 	static void openFileDialog() noexcept;
+	static void openInstanceDialog() noexcept;
+
+	template <typename Fn>
+	void forEachCore(Fn&& fn) {
+		if (mSystemCore) { fn(*mSystemCore); }
+		for (auto& core : mInstances) { fn(*core); }
+	}
+
+	// The core whose view has focus, to take keyboard input, else the main one.
+	SystemInterface* getFocusedCore(const VideoSink* focused) noexcept;
 
 public:
 	static inline HomeDirManager*  HDM{};
 	static inline GlobalAudioBase* GAB{};
 	static inline BasicVideoSpec*  BVS{};
 
+	// Emulated frames per host frame while the turbo key is held.
+	static constexpr u32 cTurboFrames{ 8 };
+
 private:
 	bool mShowOverlay{};
 	bool mUnlimited{};
@@ -77,6 +107,8 @@ private:
 
 	void discardCore();
 	void replaceCore();
+	void reloadCore();
+	void spawnInstance();
 
 public:
 	static auto* initialize(const Path& gamePath) noexcept {
@@ -91,7 +123,7 @@ public:
 	void hideMainWindow(bool state) noexcept;
 	void pauseSystem(bool state) noexcept;
 	void quitApplication() noexcept;
-	void loadGameFile(const Path&);
+	void loadGameFile(const Path&, bool asInstance = false);
 
 	void processFrame();
 };
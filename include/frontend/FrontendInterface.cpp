@@ -204,6 +204,8 @@ void FrontendInterface::PrepareViewport(
 		if (ImGui::BeginMenu("File")) {
 			if (auto OpenFile{ FnHook_OpenFile.load(mo::relaxed) })
 				{ if (ImGui::MenuItem("Open...")) { OpenFile(); } }
+			if (auto OpenInstance{ FnHook_OpenInstance.load(mo::relaxed) })
+				{ if (ImGui::MenuItem("Open as Instance...")) { OpenInstance(); } }
 			ImGui::EndMenu();
 		}
 		ImGui::EndMainMenuBar();
@@ -239,6 +241,27 @@ void FrontendInterface::PrepareViewport(
 	ImGui::End();
 }
 
+bool FrontendInterface::PrepareInstanceView(
+	int index, SDL_Texture* texture,
+	int width, int height
+) {
+	const auto title{ "Instance #" + std::to_string(index) };
+	const auto cascade{ 24.0f * index };
+
+	ImGui::SetNextWindowPos({ cascade, ImGui::GetFrameHeight() + cascade }, ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowSize({ float(width), height + ImGui::GetFrameHeight() }, ImGuiCond_FirstUseEver);
+
+	if (ImGui::Begin(title.c_str(), nullptr, ImGuiWindowFlags_NoScrollbar)) {
+		const auto available{ ImGui::GetContentRegionAvail() };
+		const auto scale{ std::max(std::min(available.x / width, available.y / height), 0.0f) };
+		ImGui::Image(reinterpret_cast<ImTextureID>(texture), { width * scale, height * scale });
+	}
+	const auto focused{ ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) };
+	ImGui::End();
+
+	return focused;
+}
+
 void FrontendInterface::PrepareGeneralUI() {
 	//static bool show_demo_window{ true };
 	//if (show_demo_window) {
@@ -19,6 +19,8 @@ class FrontendInterface {
 public:
 	static inline Atom<void(*)()>
 		FnHook_OpenFile{};
+	static inline Atom<void(*)()>
+		FnHook_OpenInstance{};
 
 public:
 	static void Initialize(SDL_Window*, SDL_Renderer*);
@@ -40,5 +42,10 @@ public:
 		int width, int height, int rotation,
 		const char* overlay, SDL_Texture* texture
 	);
+	// Returns whether the instance's window has focus.
+	static bool PrepareInstanceView(
+		int index, SDL_Texture* texture,
+		int width, int height
+	);
 	static void PrepareGeneralUI();
 };
@@ -0,0 +1,159 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <vector>
+#include <fstream>
+
+#include <SDL3/SDL_init.h>
+#include <SDL3/SDL_events.h>
+
+#include "HomeDirManager.hpp"
+#include "BasicLogger.hpp"
+#include "GlobalAudioBase.hpp"
+#include "HDIS_HCIS.hpp"
+
+#include "HeadlessHost.hpp"
+#include "FrontendHost.hpp"
+#include "SystemInterface.hpp"
+#include "ThreadPolicy.hpp"
+#include "CycleController.hpp"
+#include "CoreRegistry.hpp"
+
+/*==================================================================*/
+
+HeadlessHost::HeadlessHost(const Options& options) noexcept
+	: mOptions{ options }
+{
+	SystemInterface::assignComponents(HDM);
+	SystemInterface::setRandomSeed(mOptions.seed);
+	HDM->setValidator(CoreRegistry::validateProgram);
+	CoreRegistry::loadProgramDB();
+
+	if (mOptions.program.empty()) {
+		blog.newEntry(BLOG::ERROR, "Headless mode requires a program to run!");
+		return;
+	}
+	if (!HDM->validateGameFile(mOptions.program)) {
+		blog.newEntry(BLOG::ERROR, "Path has been rejected: \"{}\"", mOptions.program.string());
+		return;
+	}
+
+	mSystemCore.reset(CoreRegistry::constructCore());
+	if (!mSystemCore) { return; }
+
+	if (!mOptions.dumpDir.empty()) {
+		std::error_code error;
+		std::filesystem::create_directories(mOptions.dumpDir, error);
+		if (error) {
+			blog.newEntry(BLOG::WARN, "Cannot create frame dump directory: \"{}\" [{}]",
+				mOptions.dumpDir.string(), error.message());
+			mOptions.dumpDir.clear();
+		}
+	}
+
+	if (mOptions.hashFrames || !mOptions.dumpDir.empty()) {
+		mSystemCore->setFrameObserver([this](VideoSink& video, u64 frame)
+			{ observeFrame(video, frame); });
+	}
+	if (mOptions.benchmark) { mSystemCore->addSystemState(EmuState::BENCH); }
+
+	mSystemCore->setUnpaced(mOptions.unlimited);
+
+	mSystemCore->setFrameLimit(mOptions.frames);
+	mSystemCore->startWorker();
+}
+
+void HeadlessHost::StopSystemThread::operator()(SystemInterface* ptr) noexcept {
+	if (ptr) {
+		ptr->stopWorker();
+		ptr->~SystemInterface();
+		::operator delete(ptr, std::align_val_t(HDIS));
+	}
+}
+
+/*==================================================================*/
+
+bool HeadlessHost::initApplication(StrV overrideHome, StrV configName, bool forcePortable, bool withAudio) noexcept {
+	HDM = HomeDirManager::initialize(
+		overrideHome, configName, forcePortable, OrgName, AppName);
+	if (!HDM) { return false; }
+
+	GlobalAudioBase::Settings GAB_settings;
+	ThreadPolicy::Settings TP_settings;
+	CycleController::Settings CC_settings;
+
+	HDM->parseMainAppConfig(
+		GAB_settings.map(),
+		TP_settings.map(),
+		CC_settings.map()
+	);
+
+	ThreadPolicy::configure(TP_settings);
+	CycleController::configure(CC_settings);
+
+	if (withAudio) {
+		const auto* GAB{ GlobalAudioBase::initialize(GAB_settings) };
+		if (GAB->getStatus() == GlobalAudioBase::STATUS::NO_AUDIO)
+			{ blog.newEntry(BLOG::WARN, "Audio Subsystem is not available!"); }
+	} else {
+		GlobalAudioBase::disableOutput();
+	}
+
+	return true;
+}
+
+s32  HeadlessHost::processEvents(void* event) noexcept {
+	const auto sdl_event{ reinterpret_cast<SDL_Event*>(event) };
+	return sdl_event->type == SDL_EVENT_QUIT
+		? SDL_APP_SUCCESS : SDL_APP_CONTINUE;
+}
+
+s32  HeadlessHost::processFrame() noexcept {
+	const auto state{ mSystemCore->getSystemState() };
+
+	if (state & EmuState::FATAL)
+		[[unlikely]] { return SDL_APP_FAILURE; }
+	if (state & EmuState::HALTED)
+		[[unlikely]] { return SDL_APP_SUCCESS; }
+
+	return SDL_APP_CONTINUE;
+}
+
+void HeadlessHost::quitApplication() noexcept {
+	if (!mSystemCore) { return; }
+	mSystemCore->stopWorker();
+
+	const auto state{ mSystemCore->getSystemState() };
+	fmt::println("{} frames, {} cycles, {}, final frame {}",
+		mSystemCore->getFrameCount(), mSystemCore->getElapsedCycles(),
+		state & EmuState::FATAL ? "fatal" : state & EmuState::HALTED ? "halted" : "stopped",
+		VideoSink::hashFrame(mSystemCore->getVideoSink().readVisibleFrame()));
+
+	mSystemCore.reset();
+}
+
+/*==================================================================*/
+
+void HeadlessHost::observeFrame(VideoSink& video, u64 frame) {
+	const auto pixels{ video.readVisibleFrame() };
+
+	if (mOptions.hashFrames) { fmt::println("{:8} {}", frame, VideoSink::hashFrame(pixels)); }
+	if (mOptions.dumpDir.empty()) { return; }
+
+	const auto& size{ video.getViewportSizes().frame };
+	std::ofstream file{ mOptions.dumpDir / fmt::format("frame_{:06}.ppm", frame), std::ios::binary };
+	file << fmt::format("P6\n{} {}\n255\n", size.w, size.h);
+
+	// pixels are RGBX, ordered from the most significant byte
+	std::vector<char> rgb;
+	rgb.reserve(pixels.size() * 3);
+	for (const auto pixel : pixels) {
+		rgb.push_back(char(pixel >> 24));
+		rgb.push_back(char(pixel >> 16));
+		rgb.push_back(char(pixel >>  8));
+	}
+	file.write(rgb.data(), std::streamsize(rgb.size()));
+}
@@ -0,0 +1,72 @@
+/*
+	This Source Code Form is subject to the terms of the Mozilla Public
+	License, v. 2.0. If a copy of the MPL was not distributed with this
+	file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <memory>
+
+#include "Typedefs.hpp"
+
+/*==================================================================*/
+
+class HomeDirManager;
+class SystemInterface;
+class VideoSink;
+
+/*==================================================================*/
+
+/**
+ * @brief Runs a single core without any window, renderer or UI, for automated use.
+ *        The core runs on its usual worker thread; the main thread only watches for
+ *        it to halt, either by itself or after the requested number of frames.
+ */
+class HeadlessHost final {
+public:
+	struct Options {
+		Path program{};
+		Path dumpDir{};     // every presented frame is written here as a PPM, if set
+		u64  frames{};      // frames to run before exiting, 0 to run until halted
+		u64  seed{};        // RNG seed, fixed so that frame hashes are reproducible
+		bool hashFrames{};  // print the SHA-1 of every presented frame
+		bool unlimited{};   // run frames back to back, unpaced
+		bool benchmark{};   // let cores raise their cycles per frame, as EmuState::BENCH
+	};
+
+private:
+	HeadlessHost(const Options&) noexcept;
+
+	HeadlessHost(const HeadlessHost&) = delete;
+	HeadlessHost& operator=(const HeadlessHost&) = delete;
+
+	struct StopSystemThread {
+		void operator()(SystemInterface*) noexcept;
+	};
+	using SystemCore = std::unique_ptr
+		<SystemInterface, StopSystemThread>;
+
+	SystemCore mSystemCore;
+	Options    mOptions;
+
+	void observeFrame(VideoSink& video, u64 frame);
+
+public:
+	static inline HomeDirManager* HDM{};
+
+	static auto* initialize(const Options& options) noexcept {
+		static HeadlessHost self(options);
+		return self.mSystemCore ? &self : nullptr;
+	}
+
+	/**
+	 * @brief Sets up the file manager and settings, but no video. Audio is opened only
+	 *        if asked for, otherwise cores generate none.
+	 */
+	static bool initApplication(StrV overrideHome, StrV configName, bool forcePortable, bool withAudio) noexcept;
+
+	s32  processEvents(void* event) noexcept;
+	s32  processFrame() noexcept;
+	void quitApplication() noexcept;
+};
@@ -18,6 +18,7 @@
 #include "ColorOps.hpp"
 
 #include <vector>
+#include <algorithm>
 #include <SDL3/SDL.h>
 
 /*==================================================================*/
@@ -232,18 +233,6 @@ void BasicVideoSpec::resetMainWindow() {
 	mWindowTexture.reset();
 }
 
-void BasicVideoSpec::setViewportAlpha(u32 alpha) noexcept {
-	mTextureAlpha.store(u8(alpha), mo::release);
-}
-
-void BasicVideoSpec::setViewportSizes(s32 W, s32 H, s32 mult, s32 ppad) noexcept {
-	mNewViewport.store(Viewport::pack(W, H, mult, ppad), mo::release);
-}
-
-auto BasicVideoSpec::getViewportSizes() const noexcept -> BasicVideoSpec::Viewport {
-	return Viewport::unpack(mNewViewport.load(mo::acquire));
-}
-
 void BasicVideoSpec::setViewportScaleMode(s32 mode) noexcept {
 	switch (mode) {
 		case SDL_SCALEMODE_NEAREST:
@@ -267,10 +256,6 @@ void BasicVideoSpec::cycleViewportScaleMode() noexcept {
 	}
 }
 
-void BasicVideoSpec::setBorderColor(u32 color) noexcept {
-	mOutlineColor.store(color, mo::release);
-}
-
 /*==================================================================*/
 
 void BasicVideoSpec::prepareWindowTexture() {
@@ -295,7 +280,7 @@ void BasicVideoSpec::prepareWindowTexture() {
 	}
 }
 
-void BasicVideoSpec::prepareSystemTexture() {
+void BasicVideoSpec::prepareSystemTexture(VideoSink& sink) {
 	if (!mWindowTexture) { return; }
 
 	if (to_Frame(mSystemTexture) != mCurViewport.frame) {
@@ -311,19 +296,19 @@ void BasicVideoSpec::prepareSystemTexture() {
 			showErrorBox("Failed to create System texture!");
 		} else {
 			SDL_SetTextureScaleMode(mSystemTexture, static_cast<SDL_ScaleMode>(mViewportScaleMode));
-			SDL_SetTextureAlphaMod(mSystemTexture, mTextureAlpha.load(mo::acquire));
+			SDL_SetTextureAlphaMod(mSystemTexture, sink.getViewportAlpha());
 		}
 	}
 }
 
-void BasicVideoSpec::renderViewport() {
+void BasicVideoSpec::renderViewport(VideoSink& sink) {
 	if (!mWindowTexture && !mSystemTexture)
 		[[unlikely]] { return; }
 
 	if (mWindowTexture) {
 		SDL_SetRenderTarget(mMainRenderer, mWindowTexture);
 
-		const RGBA Color{ mOutlineColor.load(mo::acquire) };
+		const RGBA Color{ sink.getBorderColor() };
 		SDL_SetRenderDrawColor(mMainRenderer, Color.R, Color.G, Color.B, SDL_ALPHA_OPAQUE);
 		const auto outerFRect{ to_FRect(mCurViewport.padded()) };
 		SDL_RenderFillRect(mMainRenderer, &outerFRect);
@@ -338,7 +323,7 @@ void BasicVideoSpec::renderViewport() {
 			void* pixels{}; s32 pitch;
 
 			SDL_LockTexture(mSystemTexture, nullptr, &pixels, &pitch);
-			displayBuffer.read(static_cast<u32*>(pixels), mCurViewport.frame.area());
+			sink.readFrame(static_cast<u32*>(pixels), mCurViewport.frame.area());
 			SDL_UnlockTexture(mSystemTexture);
 		}
 
@@ -361,13 +346,51 @@ void BasicVideoSpec::renderViewport() {
 	SDL_SetRenderTarget(mMainRenderer, nullptr);
 }
 
-void BasicVideoSpec::renderPresent(bool core, const char* overlay_data) {
-	mCurViewport = getViewportSizes();
+void BasicVideoSpec::renderInstanceViews(std::span<VideoSink* const> sinks) {
+	// drop the textures of instances that have since gone away
+	std::erase_if(mInstanceViews, [sinks](const InstanceView& view) noexcept
+		{ return std::find(sinks.begin(), sinks.end(), view.sink) == sinks.end(); });
+	mFocusedInstance = nullptr;
+
+	for (auto i{ 0u }; i < sinks.size(); ++i) {
+		auto& sink{ *sinks[i] };
+		auto  view{ std::find_if(mInstanceViews.begin(), mInstanceViews.end(),
+			[&sink](const InstanceView& entry) noexcept { return entry.sink == &sink; }) };
+		if (view == mInstanceViews.end())
+			{ view = mInstanceViews.insert(view, InstanceView{ &sink }); }
+
+		const auto viewport{ sink.getViewportSizes() };
+		if (viewport.frame.area() <= 0) { continue; }
+
+		if (!view->texture || to_Frame(view->texture) != viewport.frame) {
+			view->texture = SDL_CreateTexture(
+				mMainRenderer,
+				SDL_PIXELFORMAT_RGBX8888,
+				SDL_TEXTUREACCESS_STREAMING,
+				viewport.frame.w, viewport.frame.h
+			);
+			if (!view->texture) { continue; }
+			SDL_SetTextureScaleMode(view->texture, SDL_SCALEMODE_NEAREST);
+		}
 
-	if (core) { prepareWindowTexture(); }
-	if (core) { prepareSystemTexture(); }
+		void* pixels{}; s32 pitch;
+		if (SDL_LockTexture(view->texture, nullptr, &pixels, &pitch)) {
+			sink.readFrame(static_cast<u32*>(pixels), viewport.frame.area());
+			SDL_UnlockTexture(view->texture);
+		}
 
-	renderViewport();
+		if (FrontendInterface::PrepareInstanceView(i + 1, view->texture,
+			viewport.scaled().w, viewport.scaled().h)) { mFocusedInstance = &sink; }
+	}
+}
+
+void BasicVideoSpec::renderPresent(VideoSink* sink, std::span<VideoSink* const> instances, const char* overlay_data) {
+	if (sink) {
+		mCurViewport = sink->getViewportSizes();
+		prepareWindowTexture();
+		prepareSystemTexture(*sink);
+		renderViewport(*sink);
+	}
 
 	FrontendInterface::NewFrame();
 
@@ -381,6 +404,7 @@ void BasicVideoSpec::renderPresent(bool core, const char* overlay_data) {
 		outerRect.w, outerRect.h, mViewportRotation,
 		overlay_data, mWindowTexture
 	);
+	renderInstanceViews(instances);
 	FrontendInterface::PrepareGeneralUI();
 	FrontendInterface::RenderFrame(mMainRenderer);
 
@@ -6,12 +6,16 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "Typedefs.hpp"
 #include "AtomSharedPtr.hpp"
-#include "TripleBuffer.hpp"
+#include "VideoSink.hpp"
 #include "LifetimeWrapperSDL.hpp"
 #include "SettingWrapper.hpp"
 #include "EzMaths.hpp"
+#include "ColorOps.hpp"
 
 /*==================================================================*/
 	#pragma region BasicVideoSpec Singleton Class
@@ -19,45 +23,7 @@
 class BasicVideoSpec final {
 
 public:
-	struct Viewport {
-		ez::Frame frame{};
-		s32 multi{}, pxpad{};
-
-		constexpr Viewport(s32 w = 0, s32 h = 0, s32 multi = 0, s32 pxpad = 0) noexcept
-			: frame{ std::clamp(w, 0x0, 0xFFF), std::clamp(h, 0x0, 0xFFF) }
-			, multi{ std::clamp(multi, 0x1, 0xF) }
-			, pxpad{ std::clamp(pxpad, 0x0, 0xF) }
-		{}
-
-		constexpr auto rotate_if(bool cond) const noexcept {
-			return cond
-				? Viewport{ frame.h, frame.w, multi, pxpad }
-				: Viewport{ frame.w, frame.h, multi, pxpad };
-		}
-
-		constexpr auto scaled() const noexcept {
-			return ez::Frame{ frame.w * multi, frame.h * multi };
-		}
-		constexpr auto padded() const noexcept {
-			return ez::Frame{ frame.w * multi + pxpad * 2, frame.h * multi + pxpad * 2 };
-		}
-
-		static constexpr auto pack(s32 w, s32 h, s32 multi, s32 pxpad) noexcept {
-			return ((u32(w)     & 0xFFFu) <<  0) |
-				   ((u32(h)     & 0xFFFu) << 12) |
-				   ((u32(multi) & 0xFu)   << 24) |
-				   ((u32(pxpad) & 0xFu)   << 28);
-		}
-
-		static constexpr auto unpack(u32 packed) noexcept {
-			return Viewport{
-				s32((packed >>  0) & 0xFFFu),
-				s32((packed >> 12) & 0xFFFu),
-				s32((packed >> 24) & 0xFu),
-				s32((packed >> 28) & 0xFu)
-			};
-		}
-	};
+	using Viewport = VideoSink::Viewport;
 
 private:
 	SDL_Unique<SDL_Window>   mMainWindow{};
@@ -65,13 +31,17 @@ private:
 	SDL_Unique<SDL_Texture>  mWindowTexture{};
 	SDL_Unique<SDL_Texture>  mSystemTexture{};
 
+	// Texture of each additional core instance shown next to the main viewport.
+	struct InstanceView {
+		const VideoSink* sink{};
+		SDL_Unique<SDL_Texture> texture{};
+	};
+	std::vector<InstanceView> mInstanceViews;
+	const VideoSink* mFocusedInstance{};
+
 /*==================================================================*/
 
 	Viewport  mCurViewport{};
-	Atom<u32> mNewViewport{};
-
-	Atom<u32> mOutlineColor{};
-	Atom<u8>  mTextureAlpha{ 0xFF };
 
 	bool mUsingScanlines{};
 	bool mIntegerScaling{};
@@ -80,8 +50,6 @@ private:
 	s32 mViewportScaleMode{};
 
 public:
-	TripleBuffer<u32> displayBuffer;
-
 	struct Settings {
 		static constexpr ez::Rect
 			defaults{ 0, 0, 640, 480 };
@@ -162,30 +130,14 @@ public:
 	auto getViewportScaleMode() const noexcept { return mViewportScaleMode; }
 	void setViewportScaleMode(s32 mode) noexcept;
 	void cycleViewportScaleMode() noexcept;
-	void setBorderColor(u32 color) noexcept;
 
 /*==================================================================*/
 
 private:
 	void prepareWindowTexture();
-	void prepareSystemTexture();
-	void renderViewport();
-
-public:
-	void setViewportAlpha(u32 alpha) noexcept;
-
-	/**
-	 * @brief Sets various parameters to shape, scale, and pad the system's Viewport. Thread-safe.
-	 * @param[in] W :: The width of the output texture in pixels.
-	 * @param[in] H :: The height of the output texture in pixels.
-	 * @param[in] mult :: Integer multiplier of the texture size to adjust minimum size. Capped at 16.
-	 * @param[in] pad :: The thickness of the padding (colorable, see 'setOutlineColor')
-	 * surrounding the Viewport in pixels. When negative, doubles as a flag that controls whether
-	 * to draw scanlines over the Viewport. Capped at -16..16.
-	 * @return Boolean if successful.
-	 */
-	void setViewportSizes(s32 W, s32 H, s32 mult = 0, s32 ppad = 0) noexcept;
-	auto getViewportSizes() const noexcept -> Viewport;
+	void prepareSystemTexture(VideoSink& sink);
+	void renderViewport(VideoSink& sink);
+	void renderInstanceViews(std::span<VideoSink* const> sinks);
 
 public:
 	void resetMainWindow();
@@ -193,7 +145,16 @@ public:
 	bool isMainWindowID(u32 id) const noexcept;
 	void raiseMainWindow();
 
-	void renderPresent(bool core, const char* overlay_data);
+	/**
+	 * @brief Draws and presents a frame of the main window.
+	 * @param[in] sink :: Video of the core shown in the main viewport, or nullptr if none.
+	 * @param[in] instances :: Video of additional cores, each shown in a window of its own.
+	 * @param[in] overlay_data :: Text drawn over the main viewport, or nullptr.
+	 */
+	void renderPresent(VideoSink* sink, std::span<VideoSink* const> instances, const char* overlay_data);
+
+	// Video of the instance whose window had focus as of the last frame, if any.
+	const VideoSink* getFocusedInstance() const noexcept { return mFocusedInstance; }
 };
 
 	#pragma endregion
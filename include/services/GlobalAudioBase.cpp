@@ -11,6 +11,7 @@
 #include "LifetimeWrapperSDL.hpp"
 
 #include <SDL3/SDL_init.h>
+#include <SDL3/SDL_audio.h>
 #include <SDL3/SDL_messagebox.h>
 
 /*==================================================================*/
@@ -21,10 +22,25 @@ GlobalAudioBase::GlobalAudioBase(const Settings& settings) noexcept {
 
 	setGlobalGain(settings.volume);
 	isMuted(settings.muted);
+	mPullModel = settings.pull_model;
+	mTargetLatency = std::clamp(settings.target_latency, 0.0f, 500.0f);
+	mCapturePath = settings.capture_path;
+
+	if (settings.shared_mixer && mStatus == STATUS::NORMAL) {
+		static constexpr SDL_AudioSpec spec{ SDL_AUDIO_F32, 1, cMixerFrequency };
+
+		mMixerOutput = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec,
+			[](void*, SDL_AudioStream* output, int additional, int)
+				{ mixInputs(output, additional); }, nullptr);
+
+		if (mMixerOutput) { SDL_ResumeAudioStreamDevice(mMixerOutput); }
+	}
 }
 
-GlobalAudioBase::~GlobalAudioBase() noexcept
-	{ SDL_QuitSubSystem(SDL_INIT_AUDIO); }
+GlobalAudioBase::~GlobalAudioBase() noexcept {
+	SDL_DestroyAudioStream(mMixerOutput);
+	SDL_QuitSubSystem(SDL_INIT_AUDIO);
+}
 
 /*==================================================================*/
 
@@ -32,6 +48,10 @@ SettingsMap GlobalAudioBase::Settings::map() noexcept {
 	return {
 		makeSetting("Audio.Volume", &volume),
 		makeSetting("Audio.Muted",  &muted),
+		makeSetting("Audio.PullModel", &pull_model),
+		makeSetting("Audio.TargetLatency", &target_latency),
+		makeSetting("Audio.SharedMixer", &shared_mixer),
+		makeSetting("Audio.CapturePath", &capture_path),
 	};
 }
 
@@ -40,6 +60,10 @@ auto GlobalAudioBase::exportSettings() const noexcept -> Settings {
 
 	out.volume = mGlobalGain.load(std::memory_order_relaxed);
 	out.muted = mIsMuted.load(std::memory_order_relaxed);
+	out.pull_model = mPullModel;
+	out.target_latency = mTargetLatency;
+	out.shared_mixer = isMixerActive();
+	out.capture_path = mCapturePath;
 
 	return out;
 }
@@ -66,6 +90,51 @@ void GlobalAudioBase::setGlobalGain(float gain) noexcept
 void GlobalAudioBase::addGlobalGain(float gain) noexcept
 	{ setGlobalGain(getGlobalGain() + gain); }
 
+float GlobalAudioBase::getEffectiveGain(float streamGain) noexcept
+	{ return isMuted() ? 0.0f : streamGain * getGlobalGain(); }
+
+/*==================================================================*/
+
+void GlobalAudioBase::attachMixerInput(SDL_AudioStream* input) {
+	std::lock_guard lock{ mMixerLock };
+	if (std::find(mMixerInputs.begin(), mMixerInputs.end(), input) == mMixerInputs.end())
+		{ mMixerInputs.push_back(input); }
+}
+
+void GlobalAudioBase::detachMixerInput(SDL_AudioStream* input) noexcept {
+	std::lock_guard lock{ mMixerLock };
+	std::erase(mMixerInputs, input);
+}
+
+void GlobalAudioBase::mixInputs(SDL_AudioStream* output, int additional) noexcept {
+	// only ever touched by the device callback thread
+	static std::vector<float> mix, scratch;
+
+	const auto count{ std::size_t(std::max(additional, 0)) / sizeof(float) };
+	if (!count) { return; }
+
+	mix.assign(count, 0.0f);
+	scratch.resize(count);
+
+	{
+		std::lock_guard lock{ mMixerLock };
+		for (auto* input : mMixerInputs) {
+			// inputs running short simply contribute silence for the remainder
+			const auto bytes{ SDL_GetAudioStreamData(input, scratch.data(), signed(count * sizeof(float))) };
+			const auto got{ std::size_t(std::max(bytes, 0)) / sizeof(float) };
+			for (auto i{ 0u }; i < got; ++i) { mix[i] += scratch[i]; }
+		}
+	}
+
+	const auto gain{ getEffectiveGain() };
+	for (auto& sample : mix)
+		{ sample = std::clamp(sample * gain, -1.0f, 1.0f); }
+
+	SDL_PutAudioStreamData(output, mix.data(), signed(count * sizeof(float)));
+}
+
+/*==================================================================*/
+
 int GlobalAudioBase::getPlaybackDeviceCount() noexcept {
 	auto deviceCount{ 0 };
 	if (mStatus == STATUS::NORMAL) {
@@ -7,14 +7,29 @@
 #pragma once
 
 #include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "SettingWrapper.hpp"
 
+struct SDL_AudioStream;
+
 /*==================================================================*/
 
 class GlobalAudioBase final {
 	static inline std::atomic<float> mGlobalGain{};
 	static inline std::atomic<bool>  mIsMuted{};
+	static inline bool mPullModel{};
+	static inline float mTargetLatency{};
+	static inline std::string mCapturePath{};
+
+	// Shared output device, its callback sums every attached input stream.
+	static inline SDL_AudioStream* mMixerOutput{};
+	static inline std::mutex mMixerLock;
+	static inline std::vector<SDL_AudioStream*> mMixerInputs;
+
+	static void mixInputs(SDL_AudioStream* output, int additional) noexcept;
 
 public:
 	enum STATUS : bool { NORMAL, NO_AUDIO };
@@ -26,6 +41,10 @@ public:
 	struct Settings {
 		float volume{ 0.75f };
 		bool  muted{ false };
+		bool  pull_model{ false };
+		float target_latency{ 40.0f };
+		bool  shared_mixer{ false };
+		std::string capture_path{};
 
 		SettingsMap map() noexcept;
 	};
@@ -47,6 +66,37 @@ public:
 
 	static bool getStatus() noexcept { return mStatus; }
 
+	// Opens no audio device for streams from now on, for runs without a listener.
+	static void disableOutput() noexcept { mStatus = STATUS::NO_AUDIO; }
+
+	// Streams opened from now on are fed through a ring drained by the device callback.
+	static bool isPullModel() noexcept { return mPullModel; }
+
+	// Queue latency in ms that streams steer towards, 0 disables rate control.
+	static float getTargetLatency() noexcept { return mTargetLatency; }
+
+	/**
+	 * @brief File that every opened stream's output is also written to, empty
+	 *        when capture is off. Streams other than ID 0 get their ID appended
+	 *        to the file stem. Capturing streams open even without an audio device.
+	 */
+	static const std::string& getCapturePath() noexcept { return mCapturePath; }
+
+	static constexpr int cMixerFrequency{ 48'000 };
+
+	// Whether streams are opened as inputs of the shared mixer instead of their own device.
+	static bool isMixerActive() noexcept { return !!mMixerOutput; }
+
+	/**
+	 * @brief Adds an unbound SDL stream to the shared mixer. Its output spec must be
+	 *        mono F32 at cMixerFrequency; its own gain is applied as it is read.
+	 */
+	static void attachMixerInput(SDL_AudioStream* input);
+	static void detachMixerInput(SDL_AudioStream* input) noexcept;
+
+	// Returns the stream gain scaled by the global gain, or 0 when muted.
+	static float getEffectiveGain(float streamGain = 1.0f) noexcept;
+
 	static bool isMuted()           noexcept;
 	static void isMuted(bool state) noexcept;
 	static void toggleMuted()       noexcept;
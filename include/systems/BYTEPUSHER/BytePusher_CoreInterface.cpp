@@ -17,7 +17,7 @@
 
 BytePusher_CoreInterface::BytePusher_CoreInterface() noexcept {
 	if (const auto* path{ HDM->addSystemDir("savestate", "BYTEPUSHER") })
-		{ sSavestatePath = *path / HDM->getFileSHA1(); }
+		{ mSavestatePath = *path / HDM->getFileSHA1(); }
 
 	loadPresetBinds();
 }
@@ -29,8 +29,13 @@ void BytePusher_CoreInterface::mainSystemLoop() {
 		[[unlikely]] { return; }
 
 	instructionLoop();
+
+	// turbo frames only run the program, the display page is read fresh each frame
+	if (isRenderSkipped()) [[unlikely]] { return; }
+
 	renderAudioData();
-	renderVideoData();
+	if (!isVideoSkipped()) [[likely]]
+		{ renderVideoData(); }
 	pushOverlayData();
 }
 
@@ -16,7 +16,7 @@
 class BytePusher_CoreInterface : public SystemInterface {
 
 protected:
-	static inline Path sSavestatePath{};
+	Path mSavestatePath{};
 
 	AudioDevice mAudioDevice;
 
@@ -46,6 +46,9 @@ protected:
 public:
 	void mainSystemLoop() override;
 
+	const AudioDevice::Stream* getOverlayAudioStream() noexcept override
+		{ return mAudioDevice.at(STREAM::MAIN); }
+
 protected:
 	static constexpr RGBA cBitsColor[]{
 		0x000000FF, 0x000033FF, 0x000066FF, 0x000099FF,
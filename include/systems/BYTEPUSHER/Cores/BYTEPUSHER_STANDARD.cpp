@@ -7,7 +7,6 @@
 #include "BYTEPUSHER_STANDARD.hpp"
 #if defined(ENABLE_BYTEPUSHER_STANDARD) && defined(ENABLE_BYTEPUSHER_STANDARD)
 
-#include "BasicVideoSpec.hpp"
 #include "GlobalAudioBase.hpp"
 #include "CoreRegistry.hpp"
 
@@ -19,51 +18,166 @@ BYTEPUSHER_STANDARD::BYTEPUSHER_STANDARD() {
 	copyGameToMemory(mMemoryBank.data());
 
 	setDisplayBorderColor(cBitsColor[0]);
+	setDisplayPalette(cBitsColor);
 
 	setViewportSizes(true, cScreenSizeX, cScreenSizeY, cResSizeMult, 2);
 	setBaseSystemFramerate(cRefreshRate);
 
-	mAudioDevice.addAudioStream(STREAM::MAIN, u32(getRealSystemFramerate() * cAudioLength));
+	mAudioDevice.addAudioStream(STREAM::MAIN, u32(getBaseSystemFramerate() * cAudioLength));
 	mAudioDevice.resumeStreams();
 }
 
 /*==================================================================*/
 
+void BYTEPUSHER_STANDARD::flushCopyRuns() noexcept {
+	if (++mRunEpoch == 0) [[unlikely]] {
+		mCopyRuns.fill({});
+		mCodeLines.fill(0);
+		mRunEpoch = 1;
+	}
+}
+
+void BYTEPUSHER_STANDARD::touchCodeLines(u32 pos, u32 size) noexcept {
+	const auto lineEnd{ (pos + size - 1) >> cCodeLineBits };
+	for (auto line{ pos >> cCodeLineBits }; line <= lineEnd; ++line) {
+		if (mCodeLines[line] == mRunEpoch) [[unlikely]]
+			{ flushCopyRuns(); return; }
+	}
+}
+
+auto BYTEPUSHER_STANDARD::analyzeCopyRun(u32 progPointer) noexcept -> CopyRun {
+	CopyRun run{ progPointer, 1, mRunEpoch };
+
+	const auto source{ readData<3>(progPointer + 0) };
+	const auto target{ readData<3>(progPointer + 3) };
+
+	if (readData<3>(progPointer + 6) == progPointer) {
+		// repeating a copy that doesn't rewrite its own operands changes nothing
+		run.idle = target - progPointer >= 9;
+	} else {
+		// extend while each instruction copies the next byte over and falls
+		// through, and the bytes written so far can neither rewrite the run's
+		// own code nor feed a later read in a way memmove wouldn't reproduce
+		for (auto count{ 1u }; count < 0x10000; ++count) {
+			const auto next{ progPointer + 9 * count };
+
+			if (next + 9 > cTotalMemory) { break; }
+			if (readData<3>(next - 3) != next) { break; }
+			if (readData<3>(next + 0) != source + count) { break; }
+			if (readData<3>(next + 3) != target + count) { break; }
+
+			if (target + count + 1 > progPointer && target < next + 9) { break; }
+			if (target > source && target - source <= count) { break; }
+
+			run.length = count + 1;
+		}
+	}
+
+	if (run.idle || run.length > 1) {
+		const auto codeEnd{ progPointer + (run.idle ? 9 : 9 * run.length) - 1 };
+		for (auto line{ progPointer >> cCodeLineBits }; line <= codeEnd >> cCodeLineBits; ++line)
+			{ mCodeLines[line] = mRunEpoch; }
+	}
+	return run;
+}
+
 void BYTEPUSHER_STANDARD::instructionLoop() noexcept {
 	const auto inputStates{ getKeyStates() };
 	      auto progPointer{ readData<3>(2) };
 
 	::assign_cast(mMemoryBank[0], inputStates >> 0x8);
 	::assign_cast(mMemoryBank[1], inputStates & 0xFF);
-	
-	auto cycleCount{ 0 };
-	for (; cycleCount < 0x10000; ++cycleCount) {
-		mMemoryBank[readData<3>(progPointer + 3)] =
-		mMemoryBank[readData<3>(progPointer + 0)];
-		progPointer = readData<3>(progPointer + 6);
+	touchCodeLines(0, 2);
+
+	// Walks the jump chain ahead of execution, fetching the code and data lines of
+	// instructions cPrefetchAhead steps away. Code may still be rewritten before
+	// execution gets there, so the walk only hints, and starts over once it no
+	// longer matches where execution went.
+	std::array<u32, cPrefetchAhead> trail; // positions the walk passed, nearest first
+	auto trailSlot{ 0u };
+	auto walkPointer{ 0u };
+
+	const auto stepWalk{ [&]() noexcept {
+		PREFETCH_READ (mMemoryBank.data() + readData<3>(walkPointer + 0));
+		PREFETCH_WRITE(mMemoryBank.data() + readData<3>(walkPointer + 3));
+		walkPointer = readData<3>(walkPointer + 6);
+		PREFETCH_READ (mMemoryBank.data() + walkPointer);
+	} };
+	const auto restartWalk{ [&]() noexcept {
+		walkPointer = readData<3>(progPointer + 6);
+		for (auto& pos : trail) { pos = walkPointer; stepWalk(); }
+		trailSlot = 0;
+	} };
+
+	restartWalk();
+
+	auto cyclesLeft{ 0x10000u };
+	while (cyclesLeft) {
+		auto run{ CopyRun{} };
+		if (mCoalesceRuns) [[likely]] {
+			auto& entry{ mCopyRuns[(progPointer ^ progPointer >> 16) & 0xFFFF] };
+			if (entry.origin != progPointer || entry.epoch != mRunEpoch) [[unlikely]]
+				{ entry = analyzeCopyRun(progPointer); }
+			run = entry;
+		}
+
+		const auto source{ readData<3>(progPointer + 0) };
+		const auto target{ readData<3>(progPointer + 3) };
+
+		if (run.length > 1) {
+			const auto count{ std::min(run.length, cyclesLeft) };
+
+			std::memmove(&mMemoryBank[target], &mMemoryBank[source], count);
+			touchCodeLines(target, count);
+
+			progPointer = count == run.length
+				? readData<3>(progPointer + 9 * count - 3)
+				: progPointer + 9 * count;
+			cyclesLeft -= count;
+			restartWalk();
+		} else {
+			mMemoryBank[target] = mMemoryBank[source];
+			touchCodeLines(target, 1);
+
+			if (run.idle) { break; }
+
+			progPointer = readData<3>(progPointer + 6);
+			--cyclesLeft;
+
+			if (progPointer != trail[trailSlot]) [[unlikely]] { restartWalk(); continue; }
+			// the slot execution just reached now holds the walk's farthest step
+			trail[trailSlot] = walkPointer;
+			trailSlot = (trailSlot + 1) % cPrefetchAhead;
+			stepWalk();
+		}
 	}
+	// an idle spin still runs the full frame of instructions on real hardware
+	mElapsedCycles += 0x10000u;
 }
 
 void BYTEPUSHER_STANDARD::renderAudioData() {
 	if (auto* stream{ mAudioDevice.at(STREAM::MAIN) }) {
-		const auto samplesOffset{ mMemoryBank.data() + (readData<2>(6) << 8) };
-		auto buffer{ ::allocate_n<f32>(stream->getNextBufferSize(getRealSystemFramerate()))
-			.as_value().release_as_container() };
-
-		static constexpr auto master_gain{ 0.22f };
-
-		std::transform(EXEC_POLICY(unseq)
-			samplesOffset, samplesOffset + cAudioLength, buffer.data(),
-			[](const auto sample) noexcept { return s8(sample) * (master_gain / 127.0f); }
-		);
-
-		mAudioDevice[STREAM::MAIN].pushAudioData(buffer);
+		const auto samplesOffset{ reinterpret_cast<const s8*>(
+			mMemoryBank.data() + (readData<2>(6) << 8)) };
+		const auto bufferSize{ std::min<u32>(u32(mAudioBuffer.size()),
+			stream->getNextBufferSize(getBaseSystemFramerate())) };
+		const auto sampleCount{ std::min<u32>(cAudioLength, bufferSize) };
+
+		static constexpr auto sample_gain{ 0.22f / 127.0f };
+
+		SUGGEST_VECTORIZABLE_LOOP
+		for (auto i{ 0u }; i < sampleCount; ++i)
+			{ mAudioBuffer[i] = samplesOffset[i] * sample_gain; }
+		// the sample clock may round a frame up past what the page holds
+		std::fill(mAudioBuffer.begin() + sampleCount, mAudioBuffer.begin() + bufferSize,
+			sampleCount ? mAudioBuffer[sampleCount - 1] : 0.0f);
+
+		stream->pushStretchedAudio({ mAudioBuffer.data(), bufferSize }, getFramerateMultiplier());
 	}
 }
 
 void BYTEPUSHER_STANDARD::renderVideoData() {
-	BVS->displayBuffer.write(mMemoryBank.data() + (readData<1>(5) << 16), cScreenSizeX * cScreenSizeY,
-		[](u32 pixel) noexcept { return cBitsColor[pixel]; });
+	Video->indexedBuffer.write(mMemoryBank.data() + (readData<1>(5) << 16), cScreenSizeX * cScreenSizeY);
 }
 
 #endif
@@ -15,7 +15,7 @@
 
 class BYTEPUSHER_STANDARD final : public BytePusher_CoreInterface {
 	static constexpr u64 cTotalMemory{ MiB(16) };
-	static constexpr u32 cSafezoneOOB{     8 };
+	static constexpr u32 cSafezoneOOB{    16 }; // covers 4-byte operand loads at PC + 8
 	static constexpr f32 cRefreshRate{ 60.0f };
 
 	static constexpr s32 cAudioLength{ 256 };
@@ -30,6 +30,10 @@ private:
 	std::array<u8, cTotalMemory + cSafezoneOOB>
 		mMemoryBank{};
 
+	// room for framerate drift in the stream's per-frame sample count
+	std::array<f32, cAudioLength * 2>
+		mAudioBuffer{};
+
 	template<u32 T> requires (T >= 1 && T <= 3)
 		u32 readData(u32 pos) const noexcept {
 		if        constexpr (T == 1) {
@@ -38,12 +42,45 @@ private:
 			return mMemoryBank[pos + 0] << 8
 				 | mMemoryBank[pos + 1];
 		} else if constexpr (T == 3) {
-			return mMemoryBank[pos + 0] << 16
-				 | mMemoryBank[pos + 1] << 8
-				 | mMemoryBank[pos + 2];
+			if constexpr (std::endian::native == std::endian::little) {
+				// one unaligned load, big-endian 24-bit value in the top three bytes
+				u32 word; std::memcpy(&word, mMemoryBank.data() + pos, sizeof(word));
+				return ez::byteSwap32(word) >> 8;
+			} else {
+				return mMemoryBank[pos + 0] << 16
+					 | mMemoryBank[pos + 1] <<  8
+					 | mMemoryBank[pos + 2];
+			}
 		}
 	}
 
+/*==================================================================*/
+
+	static constexpr u32 cCodeLineBits{ 6 }; // 64-byte granularity for code tracking
+	static constexpr u32 cPrefetchAhead{ 8 }; // instructions the prefetch walk runs ahead
+
+	struct CopyRun {
+		u32  origin{ ~0u }; // program pointer the run was analyzed at
+		u32  length{};      // instructions coalescable into a single memmove
+		u32  epoch{};       // cache epoch the run was analyzed in
+		bool idle{};        // instruction loops on itself, result is idempotent
+	};
+
+	u32  mRunEpoch{ 1 };
+	bool mCoalesceRuns{ true };
+
+	// direct-mapped by program pointer, entries are stale unless their epoch is current
+	std::array<CopyRun, 0x10000>
+		mCopyRuns{};
+
+	// epoch of the last run whose code overlaps each line, writes there flush the cache
+	std::array<u32, (cTotalMemory >> cCodeLineBits)>
+		mCodeLines{};
+
+	void flushCopyRuns() noexcept;
+	void touchCodeLines(u32 pos, u32 size) noexcept;
+	CopyRun analyzeCopyRun(u32 progPointer) noexcept;
+
 	void instructionLoop() noexcept override;
 	void renderAudioData() override;
 	void renderVideoData() override;
@@ -59,6 +96,12 @@ public:
 		return fileSize <= cTotalMemory;
 	}
 
+	/**
+	 * @brief Turns the copy run cache off, leaving every instruction to the single-step
+	 *        path, so that path can be measured on its own. Emulation is unaffected.
+	 */
+	void setRunCoalescing(bool state) noexcept { mCoalesceRuns = state; }
+
 	s32 getMaxDisplayW() const noexcept override { return cScreenSizeX; }
 	s32 getMaxDisplayH() const noexcept override { return cScreenSizeY; }
 };
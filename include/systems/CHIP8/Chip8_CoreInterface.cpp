@@ -5,7 +5,6 @@
 */
 
 #include "HomeDirManager.hpp"
-#include "BasicVideoSpec.hpp"
 #include "GlobalAudioBase.hpp"
 #include "BasicLogger.hpp"
 #include "SimpleFileIO.hpp"
@@ -16,10 +15,10 @@
 
 Chip8_CoreInterface::Chip8_CoreInterface() noexcept {
 	if (const auto* path{ HDM->addSystemDir("savestate", "CHIP8") })
-		{ sSavestatePath = *path / HDM->getFileSHA1(); }
+		{ mSavestatePath = *path / HDM->getFileSHA1(); }
 
 	if (const auto* path{ HDM->addSystemDir("permaRegs", "CHIP8") })
-		{ sPermaRegsPath = *path / HDM->getFileSHA1(); }
+		{ mPermaRegsPath = *path / HDM->getFileSHA1(); }
 
 	mAudioDevice.addAudioStream(STREAM::MAIN, 48'000);
 	mAudioDevice.resumeStreams();
@@ -32,9 +31,13 @@ Chip8_CoreInterface::Chip8_CoreInterface() noexcept {
 void Chip8_CoreInterface::updateKeyStates() {
 	if (!std::size(mCustomBinds)) { return; }
 
-	Input->updateStates();
+	Input->updateStates(Pacer->getFramePeriod());
 
 	mKeysPrev = mKeysCurr;
+	refreshKeyStates();
+}
+
+void Chip8_CoreInterface::refreshKeyStates() {
 	mKeysCurr = 0;
 
 	for (const auto& mapping : mCustomBinds) {
@@ -102,8 +105,7 @@ void Chip8_CoreInterface::handlePreFrameInterrupt() noexcept {
 			return;
 
 		case Interrupt::SOUND:
-			for (auto& timer : mAudioTimers)
-				{ if (timer.get()) { return; } }
+			if (mVoices.anyActive()) { return; }
 			mInterrupt = Interrupt::WAIT1;
 			mTargetCPF = 0;
 			return;
@@ -152,8 +154,7 @@ void Chip8_CoreInterface::handleEndFrameInterrupt() noexcept {
 void Chip8_CoreInterface::handleTimerTick() noexcept {
 	if (mDelayTimer) { --mDelayTimer; }
 
-	for (auto& timer : mAudioTimers)
-		{ timer.dec(); }
+	mVoices.tickTimers();
 }
 
 void Chip8_CoreInterface::nextInstruction() noexcept {
@@ -181,31 +182,61 @@ void Chip8_CoreInterface::mainSystemLoop() {
 
 	handleTimerTick();
 	handlePreFrameInterrupt();
-	instructionLoop();
+	runInstructionLoop();
 	handleEndFrameInterrupt();
 
+	if (isRenderSkipped()) [[unlikely]] {
+		skipAudioData();
+		skipVideoData();
+		return;
+	}
+
 	renderAudioData();
-	renderVideoData();
+	if (isVideoSkipped()) [[unlikely]]
+		{ skipVideoData(); }
+	else { renderVideoData(); }
 	pushOverlayData();
+
+	regulateCycles();
+}
+
+void Chip8_CoreInterface::runCycleSlice(s32& speed, s32 cycles) noexcept {
+	if (cycles <= 0) { return; }
+
+	mTargetCPF = cycles;
+	instructionLoop();
+
+	// carry over speed switches and interrupts the program made within the slice
+	if (std::abs(mTargetCPF) != cycles) { speed = std::abs(mTargetCPF); }
+	mTargetCPF = mTargetCPF < 0 ? -speed : speed;
+}
+
+void Chip8_CoreInterface::runInstructionLoop() noexcept {
+	auto speed{ mTargetCPF };
+
+	for (auto slice{ 1 }; slice <= cInputSlices && mTargetCPF > 0; ++slice) {
+		runCycleSlice(speed, s32(s64(speed) * slice / cInputSlices)
+			- s32(s64(speed) * (slice - 1) / cInputSlices));
+
+		if (slice < cInputSlices && Input->applyEvents(slice, cInputSlices))
+			{ refreshKeyStates(); }
+	}
 }
 
 Str* Chip8_CoreInterface::makeOverlayData() {
-	static constexpr std::array<f32, 5> cpf
-		{ { 1.5e6f, 1.0e6f, 0.6e6f, 0.3e6f, 1.0e5f } };
-
-	const auto frameTime{ Pacer->getElapsedMicrosSince() / 1000.0f };
-	const auto timePhase{ std::min(frameTime * 1.025f / Pacer->getFramespan(), 2.0f) };
-	const auto newStride{ ez::peak_mirror_fold(u32(timePhase / 0.2f), cpf.size()) };
-	const auto cycleBias{ cpf[newStride] * std::cos(timePhase * f32(std::numbers::pi / 2)) };
-
-	if (mInterrupt == Interrupt::CLEAR) [[likely]]
-		{ ::assign_cast_add(mTargetCPF, cycleBias); }
-
-	*getOverlayDataBuffer() = fmt::format(
-		" ::  MIPS:{:8.2f}\n{}",
-		mTargetCPF * getRealSystemFramerate() / 1'000'000.0f,
-		*SystemInterface::makeOverlayData()
-	);
+	if (getSystemState() & EmuState::BENCH) [[likely]] {
+		*getOverlayDataBuffer() = fmt::format(
+			" ::  MIPS:{:8.2f} |{:6.1f}% load\n{}",
+			mCycleControl.getMIPS(), mCycleControl.getLoad() * 100.0f,
+			*SystemInterface::makeOverlayData()
+		);
+	} else {
+		*getOverlayDataBuffer() = fmt::format(
+			" ::  MIPS:{:8.2f}\n{}",
+			std::abs(mTargetCPF) * getRealSystemFramerate() / 1'000'000.0f,
+			*SystemInterface::makeOverlayData()
+		);
+	}
 	return getOverlayDataBuffer();
 }
 
@@ -218,47 +249,44 @@ void Chip8_CoreInterface::pushOverlayData() {
 /*==================================================================*/
 
 void Chip8_CoreInterface::startVoice(s32 duration, s32 tone) noexcept {
-	thread_local auto voice_index{ 0 };
-	startVoiceAt(voice_index, duration, tone);
-	if (duration) { ++voice_index %= VOICE::COUNT - 1; }
+	startVoiceAt(mNextVoice, duration, tone);
+	if (duration) { ++mNextVoice %= VOICE::COUNT - 1; }
 }
 
 void Chip8_CoreInterface::startVoiceAt(u32 voice_index, u32 duration, u32 tone) noexcept {
-	mAudioTimers[voice_index].set(duration);
+	mVoices.timer(voice_index).set(duration);
 	if (auto* stream{ mAudioDevice.at(STREAM::MAIN) }) {
-		mVoices[voice_index].setStep((sTonalOffset + (tone ? tone : 8 \
+		mVoices.setStep(voice_index, (sTonalOffset + (tone ? tone : 8 \
 			* (((mCurrentPC >> 1) + mStackTop + 1) & 0x3E) \
-		)) / stream->getFreq() * getFramerateMultiplier());
+		)) / stream->getFreq());
 	}
 }
 
-void Chip8_CoreInterface::mixAudioData(VoiceGenerators processors) noexcept {
+void Chip8_CoreInterface::mixAudioData(std::initializer_list<u32> pulseVoices) noexcept {
 	if (auto* stream{ mAudioDevice.at(STREAM::MAIN) }) {
 
-		auto buffer{ ::allocate_n<f32>(stream->getNextBufferSize(getRealSystemFramerate()))
-			.as_value().release_as_container() };
+		auto buffer{ stream->borrowMixBuffer(
+			stream->getNextBufferSize(getBaseSystemFramerate())) };
 
-		for (auto& bundle : processors)
-			{ bundle.run(buffer, stream); }
+		mVoices.mixPulse(buffer.data(), u32(buffer.size()),
+			{ pulseVoices.begin(), pulseVoices.size() });
+		mixCustomVoices(buffer);
 
-		for (auto& sample : buffer)
-			{ sample = ez::fast_tanh(sample); }
+		::softClipBlock(buffer.data(), buffer.size());
 
-		stream->pushAudioData(buffer);
+		// generated at emulated speed, compressed to real time here
+		stream->pushStretchedAudio(buffer, getFramerateMultiplier());
 	}
 }
 
-void Chip8_CoreInterface::makePulseWave(f32* data, u32 size, Voice* voice, Stream*) noexcept {
-	if (!voice || !voice->userdata) [[unlikely]] { return; }
-	auto* timer{ static_cast<AudioTimer*>(voice->userdata) };
+void Chip8_CoreInterface::skipAudioData() noexcept {
+	if (auto* stream{ mAudioDevice.at(STREAM::MAIN) }) {
+		const auto samples{ u32(stream->getFreq() / getBaseSystemFramerate()) };
 
-	for (auto i{ 0u }; i < size; ++i) {
-		if (const auto gain{ voice->getLevel(i, *timer) }) {
-			::assign_cast_add(data[i], \
-				WaveForms::pulse(voice->peekPhase(i)) * gain);
-		} else break;
+		skipCustomVoices(samples);
+		for (auto i{ 0u }; i < mVoices.size(); ++i)
+			{ mVoices.advance(i, samples); }
 	}
-	voice->stepPhase(size);
 }
 
 void Chip8_CoreInterface::instructionError(u32 HI, u32 LO) {
@@ -284,7 +312,7 @@ bool Chip8_CoreInterface::checkRegularFile(const Path& filePath) const noexcept
 }
 
 bool Chip8_CoreInterface::newPermaRegsFile(const Path& filePath) const noexcept {
-	static constexpr char dataPadding[std::size(sPermRegsV)]{};
+	static constexpr char dataPadding[std::tuple_size_v<decltype(mPermRegsV)>]{};
 	const auto fileCreated{ ::writeFileData(filePath, dataPadding) };
 	if (!fileCreated) {
 		blog.newEntry(BLOG::ERROR, "\"{}\" [{}]",
@@ -294,42 +322,42 @@ bool Chip8_CoreInterface::newPermaRegsFile(const Path& filePath) const noexcept
 }
 
 void Chip8_CoreInterface::setFilePermaRegs(u32 X) noexcept {
-	auto fileData{ ::writeFileData(sPermaRegsPath, mRegisterV, X) };
+	auto fileData{ ::writeFileData(mPermaRegsPath, mRegisterV, X) };
 	if (!fileData) {
 		blog.newEntry(BLOG::ERROR, "File IO error: \"{}\" [{}]",
-			sPermaRegsPath.string(), fileData.error().message());
+			mPermaRegsPath.string(), fileData.error().message());
 	}
 }
 
 void Chip8_CoreInterface::getFilePermaRegs(u32 X) noexcept {
-	::assign_cast(X, std::min(X, u32(sPermRegsV.size())));
-	auto fileData{ ::readFileData(sPermaRegsPath, X) };
+	::assign_cast(X, std::min(X, u32(mPermRegsV.size())));
+	auto fileData{ ::readFileData(mPermaRegsPath, X) };
 	if (!fileData) {
 		blog.newEntry(BLOG::ERROR, "File IO error: \"{}\" [{}]",
-			sPermaRegsPath.string(), fileData.error().message());
+			mPermaRegsPath.string(), fileData.error().message());
 	} else {
-		std::copy_n(fileData.value().begin(), X, sPermRegsV.begin());
+		std::copy_n(fileData.value().begin(), X, mPermRegsV.begin());
 	}
 }
 
 void Chip8_CoreInterface::setPermaRegs(u32 X) noexcept {
-	if (!sPermaRegsPath.empty()) {
-		if (checkRegularFile(sPermaRegsPath)) { setFilePermaRegs(X); }
-		else { sPermaRegsPath.clear(); }
+	if (!mPermaRegsPath.empty()) {
+		if (checkRegularFile(mPermaRegsPath)) { setFilePermaRegs(X); }
+		else { mPermaRegsPath.clear(); }
 	}
-	std::copy_n(mRegisterV.begin(), X, sPermRegsV.begin());
+	std::copy_n(mRegisterV.begin(), X, mPermRegsV.begin());
 }
 
 void Chip8_CoreInterface::getPermaRegs(u32 X) noexcept {
-	if (!sPermaRegsPath.empty()) {
-		if (!checkRegularFile(sPermaRegsPath)) {
-			if (!newPermaRegsFile(sPermaRegsPath)) { sPermaRegsPath.clear(); }
+	if (!mPermaRegsPath.empty()) {
+		if (!checkRegularFile(mPermaRegsPath)) {
+			if (!newPermaRegsFile(mPermaRegsPath)) { mPermaRegsPath.clear(); }
 		}
 
-		if (checkRegularFile(sPermaRegsPath)) { getFilePermaRegs(X); }
-		else { sPermaRegsPath.clear(); }
+		if (checkRegularFile(mPermaRegsPath)) { getFilePermaRegs(X); }
+		else { mPermaRegsPath.clear(); }
 	}
-	std::copy_n(sPermRegsV.begin(), X, mRegisterV.begin());
+	std::copy_n(mPermRegsV.begin(), X, mRegisterV.begin());
 }
 
 /*==================================================================*/
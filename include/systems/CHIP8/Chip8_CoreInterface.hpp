@@ -22,8 +22,8 @@ protected:
 		BUZZER = ID_3, UNIQUE = ID_0,
 	};
 
-	static inline thread_local Path sPermaRegsPath{};
-	static inline thread_local Path sSavestatePath{};
+	Path mPermaRegsPath{};
+	Path mSavestatePath{};
 	static constexpr f32 sTonalOffset{ 160.0f };
 
 	std::vector<SimpleKeyMapping> mCustomBinds;
@@ -37,6 +37,9 @@ private:
 	u32  mKeysLock{}; // bitfield of keys excluded from input checks
 	u32  mKeysLoop{}; // bitfield of keys repeating input on Fx0A
 
+	void refreshKeyStates();
+	void runCycleSlice(s32& speed, s32 cycles) noexcept;
+
 protected:
 	void updateKeyStates();
 	void loadPresetBinds();
@@ -124,9 +127,8 @@ protected:
 
 	u32 mStackTop{};
 
-	static inline thread_local
 	std::array<u8, 16>
-		sPermRegsV{};
+		mPermRegsV{};
 
 	std::array<u8, 16>
 		mRegisterV{};
@@ -141,17 +143,23 @@ protected:
 
 	AudioDevice mAudioDevice;
 
-	std::array<Voice, VOICE::COUNT>
-		mVoices{};
-
-	std::array<AudioTimer, VOICE::COUNT>
-		mAudioTimers{};
+	VoicePool mVoices{ VOICE::COUNT };
+	u32 mNextVoice{}; // pulse voice the next startVoice() call takes
 
 	void startVoice(s32 duration, s32 tone = 0) noexcept;
 	void startVoiceAt(u32 voice_index, u32 duration, u32 tone = 0) noexcept;
 
-	void mixAudioData(VoiceGenerators processors) noexcept;
-	static void makePulseWave(f32* data, u32 size, Voice* voice, Stream* stream) noexcept;
+	// Mixes the listed pulse voices plus any voices of the core's own into the stream.
+	void mixAudioData(std::initializer_list<u32> pulseVoices) noexcept;
+
+	// Adds the core's non-pulse voices (if any) to the frame's mix buffer.
+	virtual void mixCustomVoices(std::span<f32>) noexcept {}
+
+	// Advances every voice by a frame's worth of samples without mixing, for turbo frames.
+	void skipAudioData() noexcept;
+
+	// Lets the core's own voices react to a skipped frame before their phases advance.
+	virtual void skipCustomVoices(u32) noexcept {}
 
 /*==================================================================*/
 
@@ -179,6 +187,13 @@ protected:
 
 	virtual void handleTimerTick() noexcept;
 	virtual void instructionLoop() noexcept = 0;
+	static constexpr s32 cInputSlices{ 8 };
+	/**
+	 * @brief Runs the frame's instructionLoop() in cInputSlices slices, applying between
+	 *        them the key events stamped up to the matching point of the frame period
+	 *        the keyboard replays, so each lands in the slice its timestamp maps to.
+	 */
+	void runInstructionLoop() noexcept;
 
 	virtual void nextInstruction() noexcept;
 	virtual void skipInstruction() noexcept;
@@ -187,6 +202,17 @@ protected:
 
 	virtual void renderAudioData() = 0;
 	virtual void renderVideoData() = 0;
+	// Stands in for renderVideoData() on turbo frames, advancing display state only.
+	virtual void skipVideoData() {}
+
+	// Ages the trail bits of every pixel by a frame, keeping the lit bit (0x8).
+	static void agePixelTrails(auto& buffer) noexcept {
+		std::for_each(EXEC_POLICY(unseq)
+			buffer.begin(), buffer.end(),
+			[](auto& pixel) noexcept
+				{ ::assign_cast(pixel, (pixel & 0x8) | (pixel >> 1)); }
+		);
+	}
 
 protected:
 	Chip8_CoreInterface() noexcept;
@@ -195,6 +221,8 @@ public:
 	void mainSystemLoop() override;
 
 	Str* makeOverlayData() override;
+	const AudioDevice::Stream* getOverlayAudioStream() noexcept override
+		{ return mAudioDevice.at(STREAM::MAIN); }
 	void pushOverlayData() override;
 
 protected:
@@ -7,7 +7,6 @@
 #include "CHIP8X.hpp"
 #if defined(ENABLE_CHIP8_SYSTEM) && defined(ENABLE_CHIP8X)
 
-#include "BasicVideoSpec.hpp"
 #include "GlobalAudioBase.hpp"
 #include "CoreRegistry.hpp"
 
@@ -25,8 +24,6 @@ CHIP8X::CHIP8X() {
 	setViewportSizes(true, cScreenSizeX, cScreenSizeY, cResSizeMult, 2);
 	setBaseSystemFramerate(cRefreshRate);
 
-	mVoices[VOICE::UNIQUE].userdata = &mAudioTimers[VOICE::UNIQUE];
-	mVoices[VOICE::BUZZER].userdata = &mAudioTimers[VOICE::BUZZER];
 
 	mCurrentPC = cStartOffset;
 	mTargetCPF = cInstSpeedHi;
@@ -207,65 +204,66 @@ void CHIP8X::instructionLoop() noexcept {
 				break;
 		}
 	}
+	mElapsedCycles += cycleCount;
 }
 
 void CHIP8X::renderAudioData() {
-	mixAudioData({
-		{ makePulseWave, &mVoices[VOICE::UNIQUE] },
-		{ makePulseWave, &mVoices[VOICE::BUZZER] },
-	});
+	mixAudioData({ VOICE::UNIQUE, VOICE::BUZZER });
 
 	static constexpr u32 idx[]{ 2, 7, 4, 1 };
-	setDisplayBorderColor(::accumulate(mAudioTimers)
+	setDisplayBorderColor(mVoices.anyActive()
 		? cForeColor[idx[mBackgroundColor]] : cBackColor[mBackgroundColor]);
 }
 
 void CHIP8X::renderVideoData() {
+	updateColorZoneMap();
+
 	if (isUsingPixelTrails()) {
-		BVS->displayBuffer.write(mDisplayBuffer, [
-			displayData = mDisplayBuffer.data(),
-			colorData   = mColoredBuffer.data(),
-			colorMask   = mColorResolution,
-			colorIndex  = mBackgroundColor,
-			foreRowLen  = mDisplay.W,
-			backRowLen  = mDisplay.W >> 3
-		](const auto& pixel) noexcept {
-			const auto I{ &pixel - displayData };
-			const auto Y{ (I / foreRowLen) & colorMask };
-			const auto X{ (I % foreRowLen) >> 3 };
+		Video->displayBuffer.write(mDisplayBuffer, mColorZoneMap, [
+			backColor = 0xFFu | cBackColor[mBackgroundColor]
+		](u32 pixel, u32 zoneColor) noexcept {
 			return (pixel != 0)
-				? cPixelOpacity[pixel] | colorData[X + Y * backRowLen]
-				: 0xFFu | cBackColor[colorIndex];
+				? cPixelOpacity[pixel] | zoneColor
+				: backColor;
 		});
 
-		std::for_each(EXEC_POLICY(unseq)
-			mDisplayBuffer.begin(), mDisplayBuffer.end(),
-			[](auto& pixel) noexcept { ::assign_cast(pixel, (pixel & 0x8) | (pixel >> 1)); }
-		);
+		agePixelTrails(mDisplayBuffer);
 	} else {
-		BVS->displayBuffer.write(mDisplayBuffer, [
-			displayData = mDisplayBuffer.data(),
-			colorData   = mColoredBuffer.data(),
-			colorMask   = mColorResolution,
-			colorIndex  = mBackgroundColor,
-			foreRowLen  = mDisplay.W,
-			backRowLen  = mDisplay.W >> 3
-		](const auto& pixel) noexcept {
-			const auto I{ &pixel - displayData };
-			const auto Y{ (I / foreRowLen) & colorMask };
-			const auto X{ (I % foreRowLen) >> 3 };
+		Video->displayBuffer.write(mDisplayBuffer, mColorZoneMap, [
+			backColor = 0xFFu | cBackColor[mBackgroundColor]
+		](u32 pixel, u32 zoneColor) noexcept {
 			return (pixel & 0x8)
-				? 0xFFu | colorData[X + Y * backRowLen]
-				: 0xFFu | cBackColor[colorIndex];
+				? 0xFFu | zoneColor
+				: backColor;
 		});
 	}
 }
 
+void CHIP8X::skipVideoData() {
+	if (isUsingPixelTrails())
+		{ agePixelTrails(mDisplayBuffer); }
+}
+
+void CHIP8X::updateColorZoneMap() noexcept {
+	if (!std::exchange(mColorZoneDirty, false)) { return; }
+
+	static constexpr auto zoneRowLen{ cScreenSizeX >> 3 };
+
+	for (auto Y{ 0 }; Y < cScreenSizeY; ++Y) {
+		const auto* zoneRow{ mColoredBuffer.data() + (Y & mColorResolution) * zoneRowLen };
+		auto* pixelRow{ mColorZoneMap.data() + Y * cScreenSizeX };
+
+		for (auto X{ 0 }; X < zoneRowLen; ++X) {
+			std::fill_n(pixelRow + X * 8, 8, zoneRow[X]);
+		}
+	}
+}
+
 void CHIP8X::setBuzzerPitch(s32 pitch) noexcept {
 	if (auto* stream{ mAudioDevice.at(STREAM::MAIN) }) {
-		mVoices[VOICE::UNIQUE].setStep((sTonalOffset + (
+		mVoices.setStep(VOICE::UNIQUE, (sTonalOffset + (
 			(0xFF - (pitch ? pitch : 0x80)) >> 3 << 4)
-		) / stream->getFreq() * getFramerateMultiplier());
+		) / stream->getFreq());
 	}
 }
 
@@ -276,6 +274,7 @@ void CHIP8X::drawLoresColor(s32 X, s32 Y, s32 idx) noexcept {
 		}
 	}
 	mColorResolution = 0xFC;
+	mColorZoneDirty  = true;
 }
 
 void CHIP8X::drawHiresColor(s32 X, s32 Y, s32 idx, s32 N) noexcept {
@@ -283,6 +282,7 @@ void CHIP8X::drawHiresColor(s32 X, s32 Y, s32 idx, s32 N) noexcept {
 		mColoredBuffer(pX & 0x7, pY & 0x1F) = cForeColor[idx & 0x7];
 	}
 	mColorResolution = 0xFF;
+	mColorZoneDirty  = true;
 }
 
 /*==================================================================*/
@@ -574,7 +574,7 @@ void CHIP8X::drawHiresColor(s32 X, s32 Y, s32 idx, s32 N) noexcept {
 		mDelayTimer = mRegisterV[X];
 	}
 	void CHIP8X::instruction_Fx18(s32 X) noexcept {
-		mAudioTimers[VOICE::UNIQUE].set(mRegisterV[X] + (mRegisterV[X] == 1));
+		mVoices.timer(VOICE::UNIQUE).set(mRegisterV[X] + (mRegisterV[X] == 1));
 	}
 	void CHIP8X::instruction_Fx1E(s32 X) noexcept {
 		::assign_cast_add(mRegisterI, mRegisterV[X]);
@@ -35,6 +35,11 @@ private:
 	u32 mBackgroundColor{ 0x00 };
 	u32 mColorResolution{ 0xFC };
 
+	// per-pixel foreground zone colors, rebuilt only when zones change
+	std::array<u32, cScreenSizeX * cScreenSizeY>
+		mColorZoneMap{};
+	bool mColorZoneDirty{ true };
+
 	std::array<u8, cScreenSizeX * cScreenSizeY>
 		mDisplayBuffer{};
 
@@ -54,6 +59,8 @@ private:
 
 	void setBuzzerPitch(s32 pitch) noexcept;
 
+	void updateColorZoneMap() noexcept;
+
 	void drawLoresColor(s32 X, s32 Y, s32 idx)        noexcept;
 	void drawHiresColor(s32 X, s32 Y, s32 idx, s32 N) noexcept;
 
@@ -76,6 +83,7 @@ private:
 
 	void renderAudioData() override;
 	void renderVideoData() override;
+	void skipVideoData() override;
 
 	void prepDisplayArea(const Resolution) override {}
 
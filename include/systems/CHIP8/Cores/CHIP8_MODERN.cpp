@@ -7,7 +7,6 @@
 #include "CHIP8_MODERN.hpp"
 #if defined(ENABLE_CHIP8_SYSTEM) && defined(ENABLE_CHIP8_MODERN)
 
-#include "BasicVideoSpec.hpp"
 #include "GlobalAudioBase.hpp"
 #include "CoreRegistry.hpp"
 
@@ -25,10 +24,6 @@ CHIP8_MODERN::CHIP8_MODERN() {
 	setViewportSizes(true, cScreenSizeX, cScreenSizeY, cResSizeMult, 2);
 	setBaseSystemFramerate(cRefreshRate);
 
-	mVoices[VOICE::ID_0].userdata = &mAudioTimers[VOICE::ID_0];
-	mVoices[VOICE::ID_1].userdata = &mAudioTimers[VOICE::ID_1];
-	mVoices[VOICE::ID_2].userdata = &mAudioTimers[VOICE::ID_2];
-	mVoices[VOICE::ID_3].userdata = &mAudioTimers[VOICE::ID_3];
 
 	mCurrentPC = cStartOffset;
 	mTargetCPF = Quirk.waitVblank ? cInstSpeedHi : cInstSpeedLo;
@@ -182,33 +177,28 @@ void CHIP8_MODERN::instructionLoop() noexcept {
 				break;
 		}
 	}
+	mElapsedCycles += cycleCount;
 }
 
 void CHIP8_MODERN::renderAudioData() {
-	mixAudioData({
-		{ makePulseWave, &mVoices[VOICE::ID_0] },
-		{ makePulseWave, &mVoices[VOICE::ID_1] },
-		{ makePulseWave, &mVoices[VOICE::ID_2] },
-		{ makePulseWave, &mVoices[VOICE::BUZZER] },
-	});
-
-	setDisplayBorderColor(sBitColors[!!::accumulate(mAudioTimers)]);
+	mixAudioData({ VOICE::ID_0, VOICE::ID_1, VOICE::ID_2, VOICE::BUZZER });
+
+	setDisplayBorderColor(sBitColors[mVoices.anyActive()]);
 }
 
 void CHIP8_MODERN::renderVideoData() {
-	BVS->displayBuffer.write(mDisplayBuffer, isUsingPixelTrails()
+	Video->displayBuffer.write(mDisplayBuffer, isUsingPixelTrails()
 		? [](u32 pixel) noexcept
 			{ return sBitColors[pixel != 0] | cPixelOpacity[pixel]; }
 		: [](u32 pixel) noexcept
 			{ return sBitColors[pixel >> 3] | 0xFFu; }
 	);
 
-	std::for_each(EXEC_POLICY(unseq)
-		mDisplayBuffer.begin(),
-		mDisplayBuffer.end(),
-		[](auto& pixel) noexcept
-			{ ::assign_cast(pixel, (pixel & 0x8) | (pixel >> 1)); }
-	);
+	agePixelTrails(mDisplayBuffer);
+}
+
+void CHIP8_MODERN::skipVideoData() {
+	agePixelTrails(mDisplayBuffer);
 }
 
 /*==================================================================*/
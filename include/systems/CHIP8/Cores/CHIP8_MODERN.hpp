@@ -63,6 +63,7 @@ private:
 
 	void renderAudioData() override;
 	void renderVideoData() override;
+	void skipVideoData() override;
 
 	void prepDisplayArea(const Resolution) override {}
 
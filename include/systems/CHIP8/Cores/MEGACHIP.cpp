@@ -7,7 +7,6 @@
 #include "MEGACHIP.hpp"
 #if defined(ENABLE_CHIP8_SYSTEM) && defined(ENABLE_MEGACHIP)
 
-#include "BasicVideoSpec.hpp"
 #include "GlobalAudioBase.hpp"
 #include "CoreRegistry.hpp"
 
@@ -22,8 +21,6 @@ MEGACHIP::MEGACHIP() {
 	setViewportSizes(true, cScreenMegaX, cScreenMegaY, cResSizeMult, 2);
 	setBaseSystemFramerate(cRefreshRate);
 
-	mVoices[VOICE::UNIQUE].userdata = &mAudioTimers[VOICE::UNIQUE];
-	mVoices[VOICE::BUZZER].userdata = &mAudioTimers[VOICE::BUZZER];
 
 	mCurrentPC = cStartOffset;
 	
@@ -291,26 +288,19 @@ void MEGACHIP::instructionLoop() noexcept {
 				break;
 		}
 	}
+	mElapsedCycles += cycleCount;
 }
 
 void MEGACHIP::renderAudioData() {
 	if (isManualRefresh()) {
-		mixAudioData({
-			{ makeByteWave,  &mVoices[VOICE::UNIQUE] },
-			{ makePulseWave, &mVoices[VOICE::BUZZER] },
-		});
+		mixAudioData({ VOICE::BUZZER });
 
-		setDisplayBorderColor(sBitColors[!!mAudioTimers[VOICE::BUZZER]]);
+		setDisplayBorderColor(sBitColors[!!mVoices.timer(VOICE::BUZZER)]);
 	}
 	else {
-		mixAudioData({
-			{ makePulseWave, &mVoices[VOICE::ID_0] },
-			{ makePulseWave, &mVoices[VOICE::ID_1] },
-			{ makePulseWave, &mVoices[VOICE::ID_2] },
-			{ makePulseWave, &mVoices[VOICE::BUZZER] },
-		});
+		mixAudioData({ VOICE::ID_0, VOICE::ID_1, VOICE::ID_2, VOICE::BUZZER });
 
-		setDisplayBorderColor(sBitColors[!!::accumulate(mAudioTimers)]);
+		setDisplayBorderColor(sBitColors[mVoices.anyActive()]);
 	}
 }
 
@@ -331,7 +321,17 @@ void MEGACHIP::renderVideoData() {
 			mBackgroundBuffer(x + 1, y + 1) = color;
 		}
 
-		BVS->displayBuffer.write(mBackgroundBuffer);
+		Video->displayBuffer.write(mBackgroundBuffer);
+	} else {
+		switch (std::exchange(mPendingPublish, Publish::NONE)) {
+			case Publish::FLUSHED:
+				Video->displayBuffer.write(mLastRenderBuffer);
+				break;
+			case Publish::BLENDED:
+				blendAndFlushBuffers();
+				break;
+			default: break;
+		}
 	}
 }
 
@@ -416,22 +416,32 @@ void MEGACHIP::scrapAllVideoBuffers() {
 	mLastRenderBuffer.initialize();
 	mBackgroundBuffer.initialize();
 	mCollisionMap.initialize();
+	mPendingPublish = Publish::NONE;
 }
 
 void MEGACHIP::flushAllVideoBuffers() {
-	BVS->displayBuffer.write(mBackgroundBuffer);
+	if (isRenderSkipped() || isVideoSkipped())
+		{ mPendingPublish = Publish::FLUSHED; }
+	else {
+		Video->displayBuffer.write(mBackgroundBuffer);
+		mPendingPublish = Publish::NONE;
+	}
 
 	mLastRenderBuffer = mBackgroundBuffer;
 	mBackgroundBuffer.initialize();
 	mCollisionMap.initialize();
 }
 
-void MEGACHIP::blendAndFlushBuffers() const {
-	BVS->displayBuffer.write(
+void MEGACHIP::blendAndFlushBuffers() {
+	if (isRenderSkipped() || isVideoSkipped())
+		{ mPendingPublish = Publish::BLENDED; return; }
+
+	Video->displayBuffer.write(
 		mLastRenderBuffer,
 		mBackgroundBuffer,
 		RGBA::blendAlpha
 	);
+	mPendingPublish = Publish::NONE;
 }
 
 void MEGACHIP::startAudioTrack(bool repeat) noexcept {
@@ -446,29 +456,37 @@ void MEGACHIP::startAudioTrack(bool repeat) noexcept {
 		const bool oob{ mTrack.data + mTrack.size > &mMemoryBank.back() };
 		if (!mTrack.size || oob) { mTrack.reset(); }
 		else {
-			mVoices[VOICE::UNIQUE].setPhase(0.0).setStep(getFramerateMultiplier() * (
-				(readMemoryI(0) << 8 | readMemoryI(1)) / f64(mTrack.size) / stream->getFreq()
-			)).userdata = &mTrack;
+			mVoices.setPhase(VOICE::UNIQUE, 0.0);
+			mVoices.setStep(VOICE::UNIQUE,
+				(readMemoryI(0) << 8 | readMemoryI(1)) / f64(mTrack.size) / stream->getFreq());
 		}
 	}
 }
 
-void MEGACHIP::makeByteWave(f32* data, u32 size, Voice* voice, Stream*) noexcept {
-	if (!voice || !voice->userdata) [[unlikely]] { return; }
-	if (auto* track{ static_cast<TrackData*>(voice->userdata) }) {
-		if (!track->isOn()) { return; }
+void MEGACHIP::mixCustomVoices(std::span<f32> buffer) noexcept {
+	if (!isManualRefresh() || !mTrack.isOn()) { return; }
 
-		for (auto i{ 0u }; i < size; ++i) {
-			const auto head{ voice->peekRawPhase(i) };
-			if (!track->loop && head >= 1.0) {
-				track->reset(); return;
-			} else {
-				::assign_cast_add(data[i], (1.0 / 128) * \
-					track->pos(head));
-			}
+	const auto phase{ mVoices.getPhase(VOICE::UNIQUE) };
+	const auto step { mVoices.getStep(VOICE::UNIQUE)  };
+
+	for (auto i{ 0u }; i < buffer.size(); ++i) {
+		const auto head{ phase + step * i };
+		if (!mTrack.loop && head >= 1.0) {
+			mTrack.reset(); return;
+		} else {
+			::assign_cast_add(buffer[i], (1.0 / 128) * \
+				mTrack.pos(head));
 		}
-		voice->stepPhase(size);
 	}
+	mVoices.advance(VOICE::UNIQUE, u32(buffer.size()));
+}
+
+void MEGACHIP::skipCustomVoices(u32 samples) noexcept {
+	if (!isManualRefresh() || !mTrack.isOn() || mTrack.loop) { return; }
+
+	// the phase wraps when advanced, so catch the track's end beforehand
+	if (mVoices.getPhase(VOICE::UNIQUE) + mVoices.getStep(VOICE::UNIQUE) * samples >= 1.0)
+		{ mTrack.reset(); }
 }
 
 void MEGACHIP::scrollBuffersUP(s32 N) {
@@ -578,7 +596,7 @@ void MEGACHIP::scrollBuffersRT() {
 		mTexture.H = NN ? NN : 256;
 	}
 	void MEGACHIP::instruction_05NN(s32 NN) noexcept {
-		BVS->setViewportAlpha(NN);
+		Video->setViewportAlpha(NN);
 	}
 	void MEGACHIP::instruction_060N(s32 N) noexcept {
 		startAudioTrack(N == 0);
@@ -57,9 +57,12 @@ class MEGACHIP final : public Chip8_CoreInterface {
 
 	void selectBlendingAlgo(s32 mode) noexcept;
 
+	// Manual refresh publish held back by a turbo or video-skipped frame.
+	enum class Publish { NONE, FLUSHED, BLENDED } mPendingPublish{};
+
 	void scrapAllVideoBuffers();
 	void flushAllVideoBuffers();
-	void blendAndFlushBuffers() const;
+	void blendAndFlushBuffers();
 
 	struct TrackData {
 		u8*  data{};
@@ -78,7 +81,8 @@ class MEGACHIP final : public Chip8_CoreInterface {
 
 	void startAudioTrack(bool repeat) noexcept;
 
-	static void makeByteWave(f32* data, u32 size, Voice* voice, Stream*) noexcept;
+	void mixCustomVoices(std::span<f32> buffer) noexcept override;
+	void skipCustomVoices(u32 samples) noexcept override;
 
 	FixedMap2D<u8, cScreenSizeX, cScreenSizeY>
 		mDisplayBuffer; // legacy 128x64 buffer
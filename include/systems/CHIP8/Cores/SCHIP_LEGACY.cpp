@@ -7,7 +7,6 @@
 #include "SCHIP_LEGACY.hpp"
 #if defined(ENABLE_CHIP8_SYSTEM) && defined(ENABLE_SCHIP_LEGACY)
 
-#include "BasicVideoSpec.hpp"
 #include "GlobalAudioBase.hpp"
 #include "CoreRegistry.hpp"
 
@@ -28,10 +27,6 @@ SCHIP_LEGACY::SCHIP_LEGACY()
 	setViewportSizes(true, cDisplayResW, cDisplayResH, cResSizeMult, 2);
 	setBaseSystemFramerate(cRefreshRate);
 
-	mVoices[VOICE::ID_0].userdata = &mAudioTimers[VOICE::ID_0];
-	mVoices[VOICE::ID_1].userdata = &mAudioTimers[VOICE::ID_1];
-	mVoices[VOICE::ID_2].userdata = &mAudioTimers[VOICE::ID_2];
-	mVoices[VOICE::ID_3].userdata = &mAudioTimers[VOICE::ID_3];
 
 	mCurrentPC = cStartOffset;
 
@@ -216,21 +211,19 @@ void SCHIP_LEGACY::instructionLoop() noexcept {
 				break;
 		}
 	}
+	mElapsedCycles += cycleCount;
 }
 
 void SCHIP_LEGACY::renderAudioData() {
-	mixAudioData({
-		{ makePulseWave, &mVoices[VOICE::ID_0] },
-		{ makePulseWave, &mVoices[VOICE::ID_1] },
-		{ makePulseWave, &mVoices[VOICE::ID_2] },
-		{ makePulseWave, &mVoices[VOICE::BUZZER] },
-	});
-
-	setDisplayBorderColor(sBitColors[!!::accumulate(mAudioTimers)]);
+	mixAudioData({ VOICE::ID_0, VOICE::ID_1, VOICE::ID_2, VOICE::BUZZER });
+
+	setDisplayBorderColor(sBitColors[mVoices.anyActive()]);
 }
 
 void SCHIP_LEGACY::renderVideoData() {
-	BVS->displayBuffer.write(mDisplayBuffer[0], isUsingPixelTrails()
+	mDisplayPlane.mergeInto(mDisplayBuffer[0].data());
+
+	Video->displayBuffer.write(mDisplayBuffer[0], isUsingPixelTrails()
 		? [](u32 pixel) noexcept {
 			return cPixelOpacity[pixel] | sBitColors[pixel != 0];
 		}
@@ -239,12 +232,12 @@ void SCHIP_LEGACY::renderVideoData() {
 		}
 	);
 
-	std::for_each(EXEC_POLICY(unseq)
-		mDisplayBuffer[0].begin(),
-		mDisplayBuffer[0].end(),
-		[](auto& pixel) noexcept
-			{ ::assign_cast(pixel, (pixel & 0x8) | (pixel >> 1)); }
-	);
+	agePixelTrails(mDisplayBuffer[0]);
+}
+
+void SCHIP_LEGACY::skipVideoData() {
+	mDisplayPlane.mergeInto(mDisplayBuffer[0].data());
+	agePixelTrails(mDisplayBuffer[0]);
 }
 
 void SCHIP_LEGACY::prepDisplayArea(const Resolution mode) {
@@ -258,12 +251,15 @@ void SCHIP_LEGACY::prepDisplayArea(const Resolution mode) {
 
 void SCHIP_LEGACY::scrollDisplayDN(s32 N) {
 	mDisplayBuffer[0].shift(0, +N);
+	mDisplayPlane.shiftDown(N);
 }
 void SCHIP_LEGACY::scrollDisplayLT() {
 	mDisplayBuffer[0].shift(-4, 0);
+	mDisplayPlane.shiftLeft(4);
 }
 void SCHIP_LEGACY::scrollDisplayRT() {
 	mDisplayBuffer[0].shift(+4, 0);
+	mDisplayPlane.shiftRight(4);
 }
 
 /*==================================================================*/
@@ -275,6 +271,7 @@ void SCHIP_LEGACY::scrollDisplayRT() {
 	void SCHIP_LEGACY::instruction_00E0() noexcept {
 		triggerInterrupt(Interrupt::FRAME);
 		mDisplayBuffer[0].initialize();
+		mDisplayPlane.clear();
 	}
 	void SCHIP_LEGACY::instruction_00EE() noexcept {
 		mCurrentPC = mStackBank[--mStackTop & 0xF];
@@ -460,44 +457,34 @@ void SCHIP_LEGACY::scrollDisplayRT() {
 
 	bool SCHIP_LEGACY::drawSingleBytes(
 		s32 originX, s32 originY,
-		s32 WIDTH,   s32 DATA
+		s32 WIDTH,   u32 DATA
 	) noexcept {
 		if (!DATA) { return false; }
-		bool collided{ false };
-
-		for (auto B{ 0 }; B < WIDTH; ++B) {
-			const auto offsetX{ originX + B };
 
-			if (DATA >> (WIDTH - 1 - B) & 0x1) {
-				auto& pixel{ mDisplayBuffer[0](offsetX, originY) };
-				if (!((pixel ^= 0x8) & 0x8)) { collided = true; }
-			}
-			if (offsetX == cDisplayResW - 1) { return collided; }
-		}
-		return collided;
+		return mDisplayPlane.toggle(originY,
+			mDisplayPlane.place(DATA, WIDTH, originX));
 	}
 
 	bool SCHIP_LEGACY::drawDoubleBytes(
 		s32 originX, s32 originY,
-		s32 WIDTH,   s32 DATA
+		s32 WIDTH,   u32 DATA
 	) noexcept {
 		if (!DATA) { return false; }
-		bool collided{ false };
 
-		for (auto B{ 0 }; B < WIDTH; ++B) {
-			const auto offsetX{ originX + B };
+		const auto collided{ mDisplayPlane.toggle(originY,
+			mDisplayPlane.place(DATA, WIDTH, originX)) };
 
-			auto& pixelHI{ mDisplayBuffer[0](offsetX, originY + 0) };
-			auto& pixelLO{ mDisplayBuffer[0](offsetX, originY + 1) };
+		// the row below mirrors the drawn span, trail bits included
+		const auto span{ mDisplayPlane.place((1ull << WIDTH) - 1, WIDTH, originX) };
+		const auto& rowHI{ mDisplayPlane[originY + 0] };
+		auto&       rowLO{ mDisplayPlane[originY + 1] };
+
+		rowLO[0] = (rowLO[0] & ~span[0]) | (rowHI[0] & span[0]);
+		rowLO[1] = (rowLO[1] & ~span[1]) | (rowHI[1] & span[1]);
+
+		const auto pixelHI{ mDisplayBuffer[0].data() + originY * cDisplayResW + originX };
+		std::copy_n(pixelHI, std::min(WIDTH, cDisplayResW - originX), pixelHI + cDisplayResW);
 
-			if (DATA >> (WIDTH - 1 - B) & 0x1) {
-				if (pixelHI & 0x8) { collided = true; }
-				pixelLO = pixelHI ^= 0x8;
-			} else {
-				pixelLO = pixelHI;
-			}
-			if (offsetX == cDisplayResW - 1) { return collided; }
-		}
 		return collided;
 	}
 
@@ -29,6 +29,7 @@ class SCHIP_LEGACY final : public Chip8_CoreInterface {
 /*==================================================================*/
 
 	Map2D<u8> mDisplayBuffer[1];
+	PackedPlane<cDisplayResH> mDisplayPlane; // authoritative lit state, merged into mDisplayBuffer per frame
 
 	std::array<u8, cTotalMemory + cSafezoneOOB>
 		mMemoryBank{};
@@ -65,6 +66,7 @@ private:
 
 	void renderAudioData() override;
 	void renderVideoData() override;
+	void skipVideoData() override;
 
 	void prepDisplayArea(const Resolution mode) override;
 
@@ -222,8 +224,8 @@ private:
 /*==================================================================*/
 	#pragma region D instruction branch
 
-	bool drawSingleBytes(s32 X, s32 Y, s32 WIDTH, s32 DATA) noexcept;
-	bool drawDoubleBytes(s32 X, s32 Y, s32 WIDTH, s32 DATA) noexcept;
+	bool drawSingleBytes(s32 X, s32 Y, s32 WIDTH, u32 DATA) noexcept;
+	bool drawDoubleBytes(s32 X, s32 Y, s32 WIDTH, u32 DATA) noexcept;
 
 	// DXYN - draw N sprite rows at VX and VY
 	void instruction_DxyN(s32 X, s32 Y, s32 N) noexcept;
@@ -7,7 +7,6 @@
 #include "SCHIP_MODERN.hpp"
 #if defined(ENABLE_CHIP8_SYSTEM) && defined(ENABLE_SCHIP_MODERN)
 
-#include "BasicVideoSpec.hpp"
 #include "GlobalAudioBase.hpp"
 #include "CoreRegistry.hpp"
 
@@ -17,6 +16,7 @@ REGISTER_CORE(SCHIP_MODERN, ".sc8")
 
 SCHIP_MODERN::SCHIP_MODERN()
 	: mDisplayBuffer{ {cScreenSizeX, cScreenSizeY} }
+	, mDisplayPlane{ cScreenSizeX, cScreenSizeY }
 {
 	::fill_n(mMemoryBank, cTotalMemory, cSafezoneOOB, 0xFF);
 
@@ -27,10 +27,6 @@ SCHIP_MODERN::SCHIP_MODERN()
 	setViewportSizes(true, cScreenSizeX, cScreenSizeY, cResSizeMult, 2);
 	setBaseSystemFramerate(cRefreshRate);
 
-	mVoices[VOICE::ID_0].userdata = &mAudioTimers[VOICE::ID_0];
-	mVoices[VOICE::ID_1].userdata = &mAudioTimers[VOICE::ID_1];
-	mVoices[VOICE::ID_2].userdata = &mAudioTimers[VOICE::ID_2];
-	mVoices[VOICE::ID_3].userdata = &mAudioTimers[VOICE::ID_3];
 
 	mCurrentPC = cStartOffset;
 	mTargetCPF = cInstSpeedLo;
@@ -214,21 +210,19 @@ void SCHIP_MODERN::instructionLoop() noexcept {
 				break;
 		}
 	}
+	mElapsedCycles += cycleCount;
 }
 
 void SCHIP_MODERN::renderAudioData() {
-	mixAudioData({
-		{ makePulseWave, &mVoices[VOICE::ID_0] },
-		{ makePulseWave, &mVoices[VOICE::ID_1] },
-		{ makePulseWave, &mVoices[VOICE::ID_2] },
-		{ makePulseWave, &mVoices[VOICE::BUZZER] },
-	});
-
-	setDisplayBorderColor(sBitColors[!!::accumulate(mAudioTimers)]);
+	mixAudioData({ VOICE::ID_0, VOICE::ID_1, VOICE::ID_2, VOICE::BUZZER });
+
+	setDisplayBorderColor(sBitColors[mVoices.anyActive()]);
 }
 
 void SCHIP_MODERN::renderVideoData() {
-	BVS->displayBuffer.write(mDisplayBuffer[0], isUsingPixelTrails()
+	mDisplayPlane.mergeInto(mDisplayBuffer[0].data());
+
+	Video->displayBuffer.write(mDisplayBuffer[0], isUsingPixelTrails()
 		? [](u32 pixel) noexcept {
 			return cPixelOpacity[pixel] | sBitColors[pixel != 0];
 		}
@@ -240,12 +234,12 @@ void SCHIP_MODERN::renderVideoData() {
 	setViewportSizes(isResolutionChanged(false), mDisplay.W, mDisplay.H,
 		isLargerDisplay() ? cResSizeMult / 2 : cResSizeMult, 2);
 
-	std::for_each(EXEC_POLICY(unseq)
-		mDisplayBuffer[0].begin(),
-		mDisplayBuffer[0].end(),
-		[](auto& pixel) noexcept
-			{ ::assign_cast(pixel, (pixel & 0x8) | (pixel >> 1)); }
-	);
+	agePixelTrails(mDisplayBuffer[0]);
+}
+
+void SCHIP_MODERN::skipVideoData() {
+	mDisplayPlane.mergeInto(mDisplayBuffer[0].data());
+	agePixelTrails(mDisplayBuffer[0]);
 }
 
 void SCHIP_MODERN::prepDisplayArea(const Resolution mode) {
@@ -258,18 +252,22 @@ void SCHIP_MODERN::prepDisplayArea(const Resolution mode) {
 	mDisplay.set(W, H);
 	
 	mDisplayBuffer[0].resizeClean(W, H);
+	mDisplayPlane.resize(W, H);
 };
 
 /*==================================================================*/
 
 void SCHIP_MODERN::scrollDisplayDN(s32 N) {
 	mDisplayBuffer[0].shift(0, +N);
+	mDisplayPlane.shiftDown(N);
 }
 void SCHIP_MODERN::scrollDisplayLT() {
 	mDisplayBuffer[0].shift(-4, 0);
+	mDisplayPlane.shiftLeft(4);
 }
 void SCHIP_MODERN::scrollDisplayRT() {
 	mDisplayBuffer[0].shift(+4, 0);
+	mDisplayPlane.shiftRight(4);
 }
 
 /*==================================================================*/
@@ -284,6 +282,7 @@ void SCHIP_MODERN::scrollDisplayRT() {
 		if (Quirk.waitVblank) [[unlikely]]
 			{ triggerInterrupt(Interrupt::FRAME); }
 		mDisplayBuffer[0].initialize();
+		mDisplayPlane.clear();
 	}
 	void SCHIP_MODERN::instruction_00EE() noexcept {
 		mCurrentPC = mStackBank[--mStackTop & 0xF];
@@ -476,34 +475,13 @@ void SCHIP_MODERN::scrollDisplayRT() {
 	#pragma region D instruction branch
 
 	void SCHIP_MODERN::drawByte(s32 X, s32 Y, u32 DATA) noexcept {
-		switch (DATA) {
-			[[unlikely]]
-			case 0b00000000:
-				return;
+		if (!DATA) [[unlikely]] { return; }
 
-			[[unlikely]]
-			case 0b10000000:
-				if (Quirk.wrapSprite) { X &= (mDisplay.W - 1); }
-				if (X < mDisplay.W) {
-					if (!((mDisplayBuffer[0](X, Y) ^= 0x8) & 0x8))
-						{ mRegisterV[0xF] = 1; }
-				}
-				return;
+		if (Quirk.wrapSprite) { X &= (mDisplay.W - 1); }
+		else if (X >= mDisplay.W) { return; }
 
-			[[likely]]
-			default:
-				if (Quirk.wrapSprite) { X &= (mDisplay.W - 1); }
-				else if (X >= mDisplay.W) { return; }
-
-				for (auto B{ 0 }; B < 8; ++B, ++X &= (mDisplay.W - 1)) {
-					if (DATA & 0x80 >> B) {
-						if (!((mDisplayBuffer[0](X, Y) ^= 0x8) & 0x8))
-							{ mRegisterV[0xF] = 1; }
-					}
-					if (!Quirk.wrapSprite && X == (mDisplay.W - 1)) { return; }
-				}
-				return;
-		}
+		if (mDisplayPlane.toggle(Y, mDisplayPlane.place(DATA, 8, X, Quirk.wrapSprite)))
+			{ mRegisterV[0xF] = 1; }
 	}
 
 	void SCHIP_MODERN::instruction_DxyN(s32 X, s32 Y, s32 N) noexcept {
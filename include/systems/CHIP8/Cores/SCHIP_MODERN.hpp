@@ -32,6 +32,7 @@ class SCHIP_MODERN final : public Chip8_CoreInterface {
 /*==================================================================*/
 
 	Map2D<u8> mDisplayBuffer[1];
+	PackedPlane<cMaxDisplayH> mDisplayPlane; // authoritative lit state, merged into mDisplayBuffer per frame
 
 	std::array<u8, cTotalMemory + cSafezoneOOB>
 		mMemoryBank{};
@@ -68,6 +69,7 @@ private:
 
 	void renderAudioData() override;
 	void renderVideoData() override;
+	void skipVideoData() override;
 
 	void prepDisplayArea(const Resolution mode) override;
 
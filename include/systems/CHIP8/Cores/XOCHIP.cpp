@@ -7,7 +7,8 @@
 #include "XOCHIP.hpp"
 #if defined(ENABLE_CHIP8_SYSTEM) && defined(ENABLE_XOCHIP)
 
-#include "BasicVideoSpec.hpp"
+#include <numbers>
+
 #include "GlobalAudioBase.hpp"
 #include "CoreRegistry.hpp"
 
@@ -37,8 +38,6 @@ XOCHIP::XOCHIP()
 
 	setPatternPitch(64);
 
-	mVoices[VOICE::UNIQUE].userdata = &mAudioTimers[VOICE::UNIQUE];
-	mVoices[VOICE::BUZZER].userdata = &mAudioTimers[VOICE::BUZZER];
 
 	mCurrentPC = cStartOffset;
 	mTargetCPF = cInstSpeedLo;
@@ -256,15 +255,13 @@ void XOCHIP::instructionLoop() noexcept {
 				break;
 		}
 	}
+	mElapsedCycles += cycleCount;
 }
 
 void XOCHIP::renderAudioData() {
-	mixAudioData({
-		{ makePatternWave, &mVoices[VOICE::UNIQUE] },
-		{ makePulseWave,   &mVoices[VOICE::BUZZER] },
-	});
+	mixAudioData({ VOICE::BUZZER });
 
-	setDisplayBorderColor(mBitColors[!!mAudioTimers[VOICE::BUZZER].get()]);
+	setDisplayBorderColor(mBitColors[!!mVoices.timer(VOICE::BUZZER).get()]);
 }
 
 void XOCHIP::renderVideoData() {
@@ -284,7 +281,7 @@ void XOCHIP::renderVideoData() {
 		}
 	);
 
-	BVS->displayBuffer.write(textureBuffer,
+	Video->displayBuffer.write(textureBuffer,
 		[pBitColors = mBitColors.data()](u32 pixel) noexcept {
 			return u32(0xFFu | pBitColors[pixel]);
 		}
@@ -313,26 +310,91 @@ void XOCHIP::setColorBit332(s32 bit, s32 index) noexcept {
 	mBitColors[bit & 0xF] = sColorPalette[index];
 }
 
+// In-place radix-2 FFT of a power-of-two sized buffer, inverse when sign is +1.
+static void transformFFT(std::span<std::complex<f32>> data, f32 sign) noexcept {
+	const auto size{ u32(data.size()) };
+
+	for (auto i{ 1u }, j{ 0u }; i < size; ++i) {
+		auto bit{ size >> 1 };
+		for (; j & bit; bit >>= 1) { j ^= bit; }
+		j ^= bit;
+		if (i < j) { std::swap(data[i], data[j]); }
+	}
+
+	for (auto len{ 2u }; len <= size; len <<= 1) {
+		const auto angle{ sign * 2.0f * std::numbers::pi_v<f32> / f32(len) };
+		const std::complex<f32> root{ std::cos(angle), std::sin(angle) };
+
+		for (auto i{ 0u }; i < size; i += len) {
+			std::complex<f32> twiddle{ 1.0f };
+			for (auto j{ 0u }; j < len / 2; ++j, twiddle *= root) {
+				const auto even{ data[i + j] };
+				const auto odd { data[i + j + len / 2] * twiddle };
+				data[i + j]           = even + odd;
+				data[i + j + len / 2] = even - odd;
+			}
+		}
+	}
+}
+
+// Picks the first mip level whose highest harmonic stays below Nyquist.
+static s32 getPatternLevel(f32 step, s32 levels) noexcept {
+	auto level{ 0 };
+	while (level + 1 < levels && f32(512 >> level) * step > 0.5f) { ++level; }
+	return level;
+}
+
+void XOCHIP::refreshPatternTable(s32 level) noexcept {
+	static constexpr auto bits{ 128u };
+	static constexpr auto tau{ 2.0f * std::numbers::pi_v<f32> };
+
+	mPatternLevel = level;
+
+	// spectrum of the 128-step pattern, periodic in the harmonic index
+	std::array<std::complex<f32>, bits> steps{};
+	for (auto b{ 0u }; b < bits; ++b)
+		{ steps[b] = (mPattern[b >> 3] >> (0x7 ^ (b & 0x7)) & 1) ? 1.0f : -1.0f; }
+	transformFFT(steps, -1.0f);
+
+	auto& spectrum{ mPatternSpectrum };
+	spectrum.fill({});
+	spectrum[0] = steps[0] / f32(bits);
+
+	// each bit is held for 1/128 of the period, shaping every harmonic k by
+	// (1 - e^(-i*tau*k/128)) / (i*tau*k) on top of the pattern's own DFT
+	const auto harmonics{ std::min(512u >> level, cPatternTableSize / 2 - 1) };
+	for (auto k{ 1u }; k <= harmonics; ++k) {
+		const auto hold{ (1.0f - std::polar(1.0f, -tau * k / bits))
+			/ std::complex<f32>{ 0.0f, tau * k } };
+		spectrum[k] = steps[k % bits] * hold;
+		spectrum[cPatternTableSize - k] = std::conj(spectrum[k]);
+	}
+	transformFFT(spectrum, +1.0f);
+
+	for (auto i{ 0u }; i < cPatternTableSize; ++i)
+		{ mPatternTable[i] = spectrum[i].real(); }
+	mPatternTable[cPatternTableSize] = mPatternTable[0];
+}
+
 void XOCHIP::setPatternPitch(s32 pitch) noexcept {
 	if (auto* stream{ mAudioDevice.at(STREAM::MAIN) }) {
-		mVoices[VOICE::UNIQUE].setStep(std::bit_cast<f32>
-			(sPitchFreqLUT[pitch]) / stream->getFreq() * getFramerateMultiplier());
+		const auto step{ std::bit_cast<f32>
+			(sPitchFreqLUT[pitch]) / stream->getFreq() };
+		mVoices.setStep(VOICE::UNIQUE, step);
+
+		if (const auto level{ getPatternLevel(step, cPatternMipLevels) }; level != mPatternLevel)
+			{ refreshPatternTable(level); }
 	}
 }
 
-void XOCHIP::makePatternWave(f32* data, u32 size, Voice* voice, Stream*) noexcept {
-	if (!voice || !voice->userdata) [[unlikely]] { return; }
-	auto* timer{ static_cast<AudioTimer*>(voice->userdata) };
+void XOCHIP::mixCustomVoices(std::span<f32> buffer) noexcept {
+	const auto* table{ mPatternTable.data() };
 
-	for (auto i{ 0u }; i < size; ++i) {
-		if (const auto gain{ voice->getLevel(i, *timer) }) {
-			const auto bitStep{ s32(voice->peekPhase(i) * 128.0f) };
-			const auto bitMask{ 1 << (0x7 ^ (bitStep & 0x7)) };
-			::assign_cast_add(data[i], \
-				(mPattern[bitStep >> 3] & bitMask) ? gain : -gain);
-		} else break;
-	}
-	voice->stepPhase(size);
+	mVoices.mixVoice(buffer.data(), u32(buffer.size()), VOICE::UNIQUE, [table](f32 phase) noexcept {
+		const auto seek{ phase * f32(cPatternTableSize) };
+		const auto idx { std::min(u32(seek), cPatternTableSize - 1) };
+		return table[idx] + (table[idx + 1] - table[idx]) * (seek - f32(idx));
+	});
 }
 
 /*==================================================================*/
@@ -707,6 +769,7 @@ void XOCHIP::scrollDisplayRT() {
 		SUGGEST_VECTORIZABLE_LOOP
 		for (auto idx{ 0 }; idx < 16; ++idx)
 			{ mPattern[idx] = readMemoryI(idx); }
+		refreshPatternTable(std::max(mPatternLevel, 0));
 	}
 	void XOCHIP::instruction_FN01(s32 N) noexcept {
 		mPlanarMask = N;
@@ -722,7 +785,7 @@ void XOCHIP::scrollDisplayRT() {
 		mDelayTimer = mRegisterV[X];
 	}
 	void XOCHIP::instruction_Fx18(s32 X) noexcept {
-		mAudioTimers[VOICE::UNIQUE].set(mRegisterV[X] + (mRegisterV[X] == 1));
+		mVoices.timer(VOICE::UNIQUE).set(mRegisterV[X] + (mRegisterV[X] == 1));
 	}
 	void XOCHIP::instruction_Fx1E(s32 X) noexcept {
 		mRegisterI = (mRegisterI + mRegisterV[X]) & 0xFFFF;
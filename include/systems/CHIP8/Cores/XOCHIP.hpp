@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <complex>
+
 #include "../Chip8_CoreInterface.hpp"
 
 #define ENABLE_XOCHIP
@@ -181,18 +183,34 @@ private:
 	}};
 
 	using PatternData = std::array<u8, 16>;
-	static inline thread_local PatternData mPattern{{
+	PatternData mPattern{{
 		0x0F, 0x00,	0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
 		0x0F, 0x00,	0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
 	}};
 
+	/**
+	 * Band-limited wavetable of the current pattern, one period over
+	 * cPatternTableSize samples plus a guard sample for interpolation.
+	 * Mip level L keeps harmonics up to 512 >> L, picked per pitch so
+	 * nothing folds past Nyquist; rebuilt only when F002 loads a new
+	 * pattern or a pitch change moves the voice to another level.
+	 */
+	static constexpr u32 cPatternTableSize{ 2048 };
+	static constexpr s32 cPatternMipLevels{ 9 };
+
+	std::array<f32, cPatternTableSize + 1> mPatternTable{};
+	std::array<std::complex<f32>, cPatternTableSize> mPatternSpectrum{};
+	s32 mPatternLevel{ -1 };
+
+	void refreshPatternTable(s32 level) noexcept;
+
 	void setPatternPitch(s32 pitch) noexcept;
 
-	static void makePatternWave(f32* data, u32 size, Voice* voice, Stream*) noexcept;
+	void mixCustomVoices(std::span<f32> buffer) noexcept override;
 
 /*==================================================================*/
 
-	static inline thread_local u32 mPlanarMask{ 0x1 };
+	u32 mPlanarMask{ 0x1 };
 
 	Map2D<u8> mDisplayBuffer[4];
 
@@ -15,7 +15,7 @@
 
 GameBoy_CoreInterface::GameBoy_CoreInterface() noexcept {
 	if (const auto* path{ HDM->addSystemDir("savestate", "GAMEBOY") })
-		{ sSavestatePath = *path / HDM->getFileSHA1(); }
+		{ mSavestatePath = *path / HDM->getFileSHA1(); }
 
 	mAudioDevice.addAudioStream(STREAM::MAIN, 48'000, 1);
 	mAudioDevice.resumeStreams();
@@ -31,8 +31,12 @@ void GameBoy_CoreInterface::mainSystemLoop() {
 
 	updateKeyStates();
 	instructionLoop();
+
+	if (isRenderSkipped()) [[unlikely]] { return; }
+
 	renderAudioData();
-	renderVideoData();
+	if (!isVideoSkipped()) [[likely]]
+		{ renderVideoData(); }
 	pushOverlayData();
 }
 
@@ -21,7 +21,7 @@ protected:
 		ID_0, ID_1, ID_2, ID_3, COUNT
 	};
 
-	static inline Path sSavestatePath{};
+	Path mSavestatePath{};
 
 	AudioDevice mAudioDevice;
 
@@ -4,57 +4,127 @@
 	file, You can obtain one at http://mozilla.org/MPL/2.0/.
 */
 
-#include "ThreadAffinity.hpp"
-#include "BasicVideoSpec.hpp"
-
 #include "SystemInterface.hpp"
 
 /*==================================================================*/
 
 void SystemInterface::startWorker() noexcept {
 	if (mCoreThread.joinable()) { return; }
+	Video->resize(getDisplaySize());
 	mCoreThread = Thread([this](StopToken token) { threadEntry(token); });
 }
 
 void SystemInterface::stopWorker() noexcept {
 	if (mCoreThread.joinable()) {
 		mCoreThread.request_stop();
+		wakeWorker();
 		mCoreThread.join();
 	}
 }
 
+void SystemInterface::wakeWorker() noexcept {
+	// taking the lock orders the state change before the parked thread's recheck
+	{ std::lock_guard lock{ mParkLock }; }
+	mParkSignal.notify_all();
+}
+
 void SystemInterface::threadEntry(StopToken token) {
-	SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
-	static thread_local thread_affinity::Manager thread{ 15, 0b11ull };
+	mThreadPolicy.apply();
 
 	Pacer->setLimiter(getBaseSystemFramerate()); // will need adjustment later
 	while (!token.stop_requested()) [[likely]] {
-		if (Pacer->checkTime()) { mainSystemLoop(); }
-		thread.refresh_affinity();
+		if (!isSystemRunning()) [[unlikely]] {
+			// nothing to emulate, sleep until a state change or stop request
+			std::unique_lock lock{ mParkLock };
+			mParkSignal.wait(lock, [&]() noexcept
+				{ return token.stop_requested() || isSystemRunning(); });
+			continue;
+		}
+		if (mUnpaced) { Pacer->markFrame(); }
+		else if (!Pacer->checkTime()) { continue; }
+
+		// turbo runs extra frames per host frame, presenting only the last one
+		for (auto frames{ getTurboFrames() }; --frames && isSystemRunning();) {
+			mRenderSkipped = true;
+			mainSystemLoop();
+			++mFrameCount;
+		}
+		mRenderSkipped = false;
+		updateFrameSkip();
+		mainSystemLoop();
+		finishFrame();
+		mThreadPolicy.update(Pacer->getOvershoot());
 	}
 }
 
+void SystemInterface::runFrames(u64 frames) {
+	if (mCoreThread.joinable()) { return; }
+
+	Video->resize(getDisplaySize());
+	for (; frames && isSystemRunning(); --frames) {
+		mRenderSkipped = frames > 1;
+		mainSystemLoop();
+		++mFrameCount;
+	}
+	mRenderSkipped = false;
+}
+
+void SystemInterface::updateFrameSkip() noexcept {
+	mLagStreak = Pacer->isKeepingPace() ? 0 : mLagStreak + 1;
+
+	// a single late frame is noise, benchmarking and observers want every frame
+	mVideoSkipped = mLagStreak >= 2 && mSkipStreak < cMaxVideoSkip
+		&& !(getSystemState() & EmuState::BENCH) && !mFrameObserver;
+
+	mSkipStreak = mVideoSkipped ? mSkipStreak + 1 : 0;
+	++(mVideoSkipped ? mFramesSkipped : mFramesShown);
+}
+
+void SystemInterface::finishFrame() {
+	++mFrameCount;
+	if (mFrameObserver && !mVideoSkipped)
+		{ mFrameObserver(*Video, mFrameCount); }
+	if (mFrameLimit && mFrameCount >= mFrameLimit)
+		{ addSystemState(EmuState::HALTED); }
+}
+
+void SystemInterface::regulateCycles() noexcept {
+	if (!(getSystemState() & EmuState::BENCH))
+		[[likely]] { mCycleControl.reset(); return; }
+	if (mTargetCPF <= 0) { return; }
+
+	// the frame timings cover every turbo frame run alongside this one
+	static constexpr s32 cMaxCycles{ 100'000'000 };
+	const auto frames{ s32(getTurboFrames()) };
+	const auto cycles{ std::min<s64>(s64(mTargetCPF) * frames, cMaxCycles) };
+	mTargetCPF = mCycleControl.update(s32(cycles),
+		Pacer->getElapsedMicrosSince() / 1000.0f, Pacer->getFramespan(),
+		Pacer->getElapsedMillisLast(), cMaxCycles) / frames;
+	mTargetCPF = std::max(mTargetCPF, 1);
+}
+
 SystemInterface::SystemInterface() noexcept
-	: mOverlayData{ std::make_shared<Str>() }
+	: mContext{ std::make_unique<SystemContext>(sRandomSeed) }
+	, mOverlayData{ std::make_shared<Str>() }
 {
-	static thread_local auto pRNG  { std::make_unique<Well512>()       };
-	static thread_local auto pPacer{ std::make_unique<FrameLimiter>()  };
-	static thread_local auto pInput{ std::make_unique<BasicKeyboard>() };
-	RNG   = pRNG.get();
-	Pacer = pPacer.get();
-	Input = pInput.get();
+	Video = &mContext->video;
+	RNG   = &mContext->rng;
+	Pacer = &mContext->pacer;
+	Input = &mContext->input;
 }
 
 /*==================================================================*/
 
 void SystemInterface::setViewportSizes(bool cond, u32 W, u32 H, u32 mult, u32 ppad) noexcept {
-	// should go through VideoDevice later instead
-	if (cond) { BVS->setViewportSizes(s32(W), s32(H), s32(mult), s32(ppad)); }
+	if (cond) { Video->setViewportSizes(s32(W), s32(H), s32(mult), s32(ppad)); }
 }
 
 void SystemInterface::setDisplayBorderColor(u32 color) noexcept {
-	// should go through VideoDevice later instead
-	BVS->setBorderColor(color);
+	Video->setBorderColor(color);
+}
+
+void SystemInterface::setDisplayPalette(const RGBA* palette) noexcept {
+	Video->setIndexedPalette(palette);
 }
 
 f32 SystemInterface::getBaseSystemFramerate() const noexcept
@@ -66,12 +136,18 @@ f32 SystemInterface::getFramerateMultiplier() const noexcept
 f32 SystemInterface::getRealSystemFramerate() const noexcept
 	{ return getBaseSystemFramerate() * getFramerateMultiplier(); }
 
+u32 SystemInterface::getTurboFrames() const noexcept
+	{ return mTurboFrames.load(mo::relaxed); }
+
 void SystemInterface::setBaseSystemFramerate(f32 value) noexcept
 	{ mBaseSystemFramerate.store(std::clamp(value, 24.0f, 100.0f), mo::relaxed); }
 
 void SystemInterface::setFramerateMultiplier(f32 value) noexcept
 	{ mFramerateMultiplier.store(std::clamp(value, 0.10f, 10.00f), mo::relaxed); }
 
+void SystemInterface::setTurboFrames(u32 frames) noexcept
+	{ mTurboFrames.store(std::clamp(frames, 1u, 64u), mo::relaxed); }
+
 void SystemInterface::saveOverlayData(const Str* data) {
 	mOverlayData.store(std::make_shared<Str>(*data), mo::release);
 }
@@ -88,6 +164,29 @@ Str* SystemInterface::makeOverlayData() {
 		frameMS, elapsed, elapsed / Pacer->getFramespan() * 100.0f
 	);
 
+	if (const auto* stream{ getOverlayAudioStream() }) {
+		const auto queued{ stream->getQueuedSamples() };
+		*getOverlayDataBuffer() += fmt::format(
+			"Audio Q:  {:9} smp |{:9.3f}ms\n"
+			"Rate Adj: {:+9.3f} %\n",
+			queued, queued * 1000.0f / stream->getFreq(),
+			(stream->getRateCorrection() - 1.0f) * 100.0f
+		);
+	}
+
+	*getOverlayDataBuffer() += fmt::format(
+		"Video:    {:9} out |{:9} skip\n",
+		mFramesShown, mFramesSkipped
+	);
+
+	const auto& policy{ mThreadPolicy.getStats() };
+	*getOverlayDataBuffer() += fmt::format(
+		"Core CPU: {:9} {:>3} |{:9} mig\n"
+		"Wake Jit: {:9.1f} us |{:9.1f}us max\n",
+		policy.core, policy.realtime ? "rt" : "", policy.migrations,
+		policy.jitterMean, policy.jitterPeak
+	);
+
 	return getOverlayDataBuffer();
 }
 
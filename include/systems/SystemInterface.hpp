@@ -7,10 +7,15 @@
 #pragma once
 
 #include <utility>
+#include <memory>
+#include <optional>
 #include <vector>
 #include <array>
 #include <span>
 #include <bit>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 
 #include "Typedefs.hpp"
 #include "Concepts.hpp"
@@ -21,9 +26,14 @@
 #include "AssignCast.hpp"
 #include "ArrayOps.hpp"
 #include "Map2D.hpp"
+#include "PackedPlane.hpp"
 #include "AudioDevice.hpp"
+#include "VideoSink.hpp"
 #include "Voice.hpp"
+#include "VoicePool.hpp"
 #include "FrameLimiter.hpp"
+#include "ThreadPolicy.hpp"
+#include "CycleController.hpp"
 #include "BasicInput.hpp"
 #include "Well512.hpp"
 
@@ -51,14 +61,39 @@ struct SimpleKeyMapping {
 };
 
 class HomeDirManager;
-class BasicVideoSpec;
 class GlobalAudioBase;
 
+/**
+ * @brief Everything a core instance owns for talking to the host, so that any
+ *        number of cores can run side by side. Audio is not part of it, as each
+ *        core already opens its own AudioDevice streams.
+ */
+struct SystemContext {
+	VideoSink     video;
+	Well512       rng;
+	FrameLimiter  pacer;
+	BasicKeyboard input{ BasicKeyboard::Source::EVENTS };
+
+	// Without a seed, the RNG is seeded from the clock.
+	explicit SystemContext(std::optional<u64> seed) noexcept
+		: rng{ seed ? Well512{ *seed } : Well512{} }
+	{}
+};
+
 /*==================================================================*/
 
 class SystemInterface {
 
 	Thread mCoreThread;
+	std::unique_ptr<SystemContext> mContext;
+
+	// The core thread sleeps on these while the system is not running.
+	std::mutex mParkLock;
+	std::condition_variable mParkSignal;
+
+	void wakeWorker() noexcept;
+
+	ThreadPolicy mThreadPolicy;
 	
 	Str mOverlayDataBuffer{};
 	AtomSharedPtr<Str>
@@ -69,9 +104,13 @@ protected:
 		{ return &mOverlayDataBuffer; }
 
 protected:
+	// Shared file loader, only meant to be used while the core is constructed.
 	static inline HomeDirManager* HDM{};
-	static inline BasicVideoSpec* BVS{};
 
+	// RNG seed given to every core constructed from then on, if any.
+	static inline std::optional<u64> sRandomSeed{};
+
+	VideoSink*     Video{};
 	Well512*       RNG{};
 	FrameLimiter*  Pacer{};
 	BasicKeyboard* Input{};
@@ -84,9 +123,56 @@ protected:
 	void threadEntry(StopToken token);
 
 	s32 mTargetCPF{};
+	u64 mElapsedCycles{}; // instructions executed since construction
+	CycleController mCycleControl;
+
+	/**
+	 * @brief While benchmarking, steers mTargetCPF towards the configured share of the
+	 *        frame budget. Call once at the end of every frame, frames with a CPF of 0
+	 *        or less (interrupted) are not measured.
+	 */
+	void regulateCycles() noexcept;
+
 	Atom<f32> mBaseSystemFramerate{};
 	Atom<f32> mFramerateMultiplier{ 1.0f };
 	Atom<u32> mGlobalState{ EmuState::NORMAL };
+	Atom<u32> mTurboFrames{ 1 };
+
+private:
+	static constexpr u32 cMaxVideoSkip{ 4 }; // frames skipped in a row at most
+
+	bool mRenderSkipped{};
+	bool mVideoSkipped{};
+	u32  mLagStreak{};  // frames in a row that missed their deadline
+	u32  mSkipStreak{}; // frames in a row with video skipped
+	u64  mFramesShown{};
+	u64  mFramesSkipped{};
+
+	u64  mFrameCount{}; // frames run by the worker, turbo frames included
+	u64  mFrameLimit{};
+	bool mUnpaced{};
+
+public:
+	using FrameObserver = std::function<void(VideoSink&, u64 frame)>;
+
+private:
+	FrameObserver mFrameObserver;
+
+	void updateFrameSkip() noexcept;
+	void finishFrame();
+
+protected:
+	/**
+	 * @brief Whether the current frame is a leading turbo frame, which only advances
+	 *        emulation state. Cores skip video conversion and audio generation then.
+	 *        A frame that stops the system renders regardless, as no other follows.
+	 */
+	bool isRenderSkipped() const noexcept { return mRenderSkipped && isSystemRunning(); }
+	/**
+	 * @brief Whether the host is falling behind and the frame's video conversion and
+	 *        publish should be skipped. Audio and emulation carry on as normal.
+	 */
+	bool isVideoSkipped()  const noexcept { return mVideoSkipped; }
 
 protected:
 	SystemInterface() noexcept;
@@ -96,18 +182,63 @@ public:
 
 public:
 	static void assignComponents(
-		HomeDirManager* const pHDM,
-		BasicVideoSpec* const pBVS
+		HomeDirManager* const pHDM
 	) noexcept {
 		HDM = pHDM;
-		BVS = pBVS;
 	}
 
-	void addSystemState(EmuState state) noexcept { mGlobalState.fetch_or ( state, mo::acq_rel); }
-	void subSystemState(EmuState state) noexcept { mGlobalState.fetch_and(~state, mo::acq_rel); }
-	void xorSystemState(EmuState state) noexcept { mGlobalState.fetch_xor( state, mo::acq_rel); }
+	/**
+	 * @brief Seeds the RNG of every core constructed from now on, so that runs can be
+	 *        reproduced, or seeds them from the clock again if empty.
+	 */
+	static void setRandomSeed(std::optional<u64> seed) noexcept {
+		sRandomSeed = seed;
+	}
+
+	// The video output of this instance, for the frontend to draw.
+	VideoSink& getVideoSink() noexcept { return *Video; }
+
+	/**
+	 * @brief Forwards a key event to the core, which applies it once its frame reaches
+	 *        the event's timestamp. Only to be called from the thread handling SDL events.
+	 * @param[in] time :: The event's SDL timestamp, in nanoseconds.
+	 */
+	void pushKeyEvent(SDL_Scancode key, bool down, u64 time) noexcept
+		{ Input->pushEvent(key, down, time); }
+
+	/**
+	 * @brief Runs the given number of frames back to back on the calling thread, with
+	 *        no pacing, presenting only the last one, or the one the system stopped at.
+	 *        Meant for batch jobs, does nothing while the worker thread is running.
+	 */
+	void runFrames(u64 frames);
+
+	// Both are owned by the worker thread, only read them while it is stopped.
+	auto getElapsedCycles() const noexcept { return mElapsedCycles; }
+	auto getFrameCount()    const noexcept { return mFrameCount; }
 
-	void setSystemState(EmuState state) noexcept { mGlobalState.store(state, mo::release); }
+	/**
+	 * @brief Makes the worker halt itself once it has run the given number of frames,
+	 *        0 for no limit. Must be set before startWorker().
+	 */
+	void setFrameLimit(u64 frames) noexcept { mFrameLimit = frames; }
+	/**
+	 * @brief Makes the worker run frames back to back instead of waiting for each one's
+	 *        deadline. Emulation is unchanged, unlike EmuState::BENCH which raises the
+	 *        cycles per frame. Must be set before startWorker().
+	 */
+	void setUnpaced(bool state) noexcept { mUnpaced = state; }
+	/**
+	 * @brief Called on the worker thread after every presented frame, with the frame
+	 *        number. Video frameskip is off while set. Must be set before startWorker().
+	 */
+	void setFrameObserver(FrameObserver observer) { mFrameObserver = std::move(observer); }
+
+	void addSystemState(EmuState state) noexcept { mGlobalState.fetch_or ( state, mo::acq_rel); wakeWorker(); }
+	void subSystemState(EmuState state) noexcept { mGlobalState.fetch_and(~state, mo::acq_rel); wakeWorker(); }
+	void xorSystemState(EmuState state) noexcept { mGlobalState.fetch_xor( state, mo::acq_rel); wakeWorker(); }
+
+	void setSystemState(EmuState state) noexcept { mGlobalState.store(state, mo::release); wakeWorker(); }
 	auto getSystemState()         const noexcept { return mGlobalState.load(mo::acquire);  }
 	bool isSystemRunning()        const noexcept { return !(getSystemState() & EmuState::NOT_RUNNING); }
 
@@ -118,16 +249,19 @@ public:
 
 protected: void setBaseSystemFramerate(f32 value) noexcept;
 public:    void setFramerateMultiplier(f32 value) noexcept;
+public:    void setTurboFrames(u32 frames) noexcept;
 
 public:    f32  getBaseSystemFramerate() const noexcept;
 public:    f32  getFramerateMultiplier() const noexcept;
 public:    f32  getRealSystemFramerate() const noexcept;
+public:    u32  getTurboFrames()         const noexcept;
 
 
 protected:
 	void setViewportSizes(bool cond, u32 W, u32 H, u32 mult, u32 ppad) noexcept;
 
 	void setDisplayBorderColor(u32 color) noexcept;
+	void setDisplayPalette(const RGBA* palette) noexcept;
 
 	virtual void mainSystemLoop() = 0;
 	
@@ -140,6 +274,10 @@ protected:
 	 * @brief Overridable method dedicated to assembling the string of Overlay data.
 	 */
 	virtual Str* makeOverlayData();
+	/**
+	 * @brief Overridable accessor for the audio stream whose queue state is shown in the Overlay.
+	 */
+	virtual const AudioDevice::Stream* getOverlayAudioStream() noexcept { return nullptr; }
 	/**
 	 * @brief Overridable method dedicated to controlling when/how the Overlay data is pushed to
 	 *        the public-facing buffer, typically used along with saveOverlayData().
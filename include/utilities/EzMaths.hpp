@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <concepts>
 #include <algorithm>
+#include <bit>
 
 /*==================================================================*/
 
@@ -205,4 +206,19 @@ namespace EzMaths {
 	}
 }
 
+/*==================================================================*/
+
+namespace EzMaths {
+	inline constexpr u32 byteSwap32(u32 data) noexcept {
+	#if defined(__cpp_lib_byteswap)
+		return std::byteswap(data);
+	#elif defined(__GNUC__) || defined(__clang__)
+		return __builtin_bswap32(data);
+	#else
+		return (data << 24) | (data << 8 & 0x00FF0000u)
+			 | (data >> 24) | (data >> 8 & 0x0000FF00u);
+	#endif
+	}
+}
+
 namespace ez = EzMaths;
@@ -20,5 +20,33 @@
 
 /*==================================================================*/
 
+#if defined(__GNUC__) || defined(__clang__)
+	#define PREFETCH_READ(addr)  __builtin_prefetch((addr), 0)
+	#define PREFETCH_WRITE(addr) __builtin_prefetch((addr), 1)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <xmmintrin.h>
+	#define PREFETCH_READ(addr)  _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+	#define PREFETCH_WRITE(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+	#define PREFETCH_READ(addr)  ((void)(addr))
+	#define PREFETCH_WRITE(addr) ((void)(addr))
+#endif
+
+/*==================================================================*/
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#include <immintrin.h>
+	#define CPU_RELAX() _mm_pause()
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+	#include <intrin.h>
+	#define CPU_RELAX() __yield()
+#elif defined(__aarch64__) || defined(__arm__)
+	#define CPU_RELAX() __asm__ __volatile__("yield")
+#else
+	#define CPU_RELAX() ((void)0)
+#endif
+
+/*==================================================================*/
+
 #define CONCAT_TOKENS_INTERNAL(x, y) x##y
 #define CONCAT_TOKENS(x, y) CONCAT_TOKENS_INTERNAL(x, y)
@@ -4,6 +4,8 @@
 	file, You can obtain one at http://mozilla.org/MPL/2.0/.
 */
 
+#include <charconv>
+
 #include "ThreadAffinity.hpp"
 #include "Millis.hpp"
 
@@ -79,6 +81,44 @@ unsigned thread_affinity::get_current_core() noexcept {
 	}
 #endif
 
+unsigned long long thread_affinity::parse_cpu_list(std::string_view cpu_list) noexcept {
+	const auto read{ [&](unsigned& value) noexcept {
+		while (!cpu_list.empty() && cpu_list.front() == ' ') { cpu_list.remove_prefix(1); }
+		const auto [ptr, ec]{ std::from_chars(cpu_list.data(), cpu_list.data() + cpu_list.size(), value) };
+		cpu_list.remove_prefix(ptr - cpu_list.data());
+		return ec == std::errc{};
+	} };
+
+	unsigned long long mask{};
+	while (!cpu_list.empty()) {
+		auto first{ 0u }, last{ 0u };
+		auto valid{ read(first) };
+		last = first;
+		if (valid && !cpu_list.empty() && cpu_list.front() == '-') {
+			cpu_list.remove_prefix(1);
+			valid = read(last);
+		}
+		for (auto i{ first }; valid && i <= last && i < 64; ++i)
+			{ mask |= 1ull << i; }
+		// skip to the next entry, malformed or not
+		const auto next{ cpu_list.find(',') };
+		cpu_list.remove_prefix(next == cpu_list.npos ? cpu_list.size() : next + 1);
+	}
+	return mask;
+}
+
+bool thread_affinity::set_realtime_policy(bool round_robin, int priority) noexcept {
+#if defined(__linux__) || defined(__APPLE__)
+	const auto policy{ round_robin ? SCHED_RR : SCHED_FIFO };
+	sched_param param{};
+	param.sched_priority = std::clamp(priority,
+		sched_get_priority_min(policy), sched_get_priority_max(policy));
+	return pthread_setschedparam(pthread_self(), policy, &param) == 0;
+#else
+	return false; // Windows has no realtime class per thread, or unknown
+#endif
+}
+
 /*==================================================================*/
 
 static auto get_core_group() noexcept {
@@ -106,7 +146,7 @@ bool thread_affinity::Manager::refresh_affinity() noexcept {
 		if (this_group != last_group) {
 			last_group = this_group;
 			timestamp = Millis::now();
-			set_affinity(this_group);
+			set_affinity(this_group & ~avoid_mask);
 			is_thread_pinned = true;
 			return true;
 		}
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <string_view>
+
 /*==================================================================*/
 
 namespace thread_affinity {
@@ -52,6 +54,22 @@ namespace thread_affinity {
 	inline bool set_affinity(unsigned long long, void* = nullptr) noexcept { return false; }
 #endif
 
+	/**
+	 * @brief Parses a CPU list such as "2-5,8" into an affinity mask. Malformed entries
+	 *        and CPUs past 63 are skipped.
+	 * @return Bitwise mask of the listed logical cores, 0 if none were valid.
+	 */
+	unsigned long long parse_cpu_list(std::string_view cpu_list) noexcept;
+
+	/**
+	 * @brief Moves the current thread to a realtime scheduling class (SCHED_FIFO or SCHED_RR),
+	 *        clamping the priority to the range the class allows. Commonly needs privileges.
+	 * @param[in] round_robin :: Use SCHED_RR instead of SCHED_FIFO.
+	 * @param[in] priority    :: Realtime priority, higher preempts lower.
+	 * @return True if successful, false if unsupported or refused.
+	 */
+	bool set_realtime_policy(bool round_robin, int priority) noexcept;
+
 /*==================================================================*/
 
 	/**